@@ -0,0 +1,56 @@
+#ifndef BUCKET_QUEUE_H
+#define BUCKET_QUEUE_H
+
+/**
+ * @struct BucketQueue
+ * @brief File de priorité à niveaux entiers (0 = plus prioritaire).
+ *
+ * Une file FIFO par niveau : pour des priorités sur 8 bits (256 niveaux),
+ * l'insertion et l'extraction sont en O(1) amorti, sans tas. Les éléments
+ * de même niveau sortent dans l'ordre d'insertion.
+ *
+ * Le niveau courant ne fait que remonter tant qu'on insère à un niveau
+ * supérieur ou égal : la recherche du prochain niveau non vide coûte au
+ * total O(nombre de niveaux) par "vague" de la file hiérarchique.
+ */
+typedef struct {
+    int *items;   // Valeurs de la file (indices de pixels en général)
+    int head;     // Prochain élément à extraire
+    int count;    // Nombre d'éléments écrits (items[head..count-1] sont en attente)
+    int capacity;
+} BucketQueueLevel;
+
+typedef struct {
+    int num_levels;
+    BucketQueueLevel *levels;
+    int current;  // Aucun niveau < current n'est occupé
+    long size;    // Nombre total d'éléments en attente
+} BucketQueue;
+
+/**
+ * @brief Crée une file vide de num_levels niveaux (0..num_levels-1).
+ * @return La file, ou NULL en cas d'erreur. À libérer avec bucket_queue_free().
+ */
+BucketQueue *bucket_queue_create(int num_levels);
+
+/**
+ * @brief Libère une file.
+ */
+void bucket_queue_free(BucketQueue *queue);
+
+/**
+ * @brief Ajoute une valeur au niveau donné (borné à [0, num_levels-1]).
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int bucket_queue_push(BucketQueue *queue, int level, int value);
+
+/**
+ * @brief Extrait la plus ancienne valeur du plus petit niveau occupé.
+ *
+ * @param queue La file.
+ * @param value Reçoit la valeur extraite.
+ * @return Le niveau de la valeur, ou -1 si la file est vide.
+ */
+int bucket_queue_pop(BucketQueue *queue, int *value);
+
+#endif // BUCKET_QUEUE_H
@@ -32,5 +32,28 @@ Image *create_histogram_image(const int *histogram, int width, int height);
  */
 int calculate_otsu_threshold(const Image *img);
 
+// Nombre maximal de seuils pour calculate_multi_otsu_thresholds
+#define MULTI_OTSU_MAX_THRESHOLDS 8
+
+/**
+ * @brief Calcule k seuils d'Otsu (k + 1 classes) maximisant la variance inter-classes.
+ *
+ * Les sommes cumulées de l'histogramme (effectifs et moments d'ordre 1)
+ * donnent le terme de chaque classe en O(1) ; une programmation dynamique
+ * sur les 256 niveaux trouve ensuite les k seuils en O(k * 256²), au lieu
+ * de O(256^k) pour une recherche exhaustive.
+ *
+ * Comme pour calculate_otsu_threshold, le seuil t est le dernier niveau de
+ * la classe inférieure dans le calcul des variances ; à l'application
+ * (apply_threshold, apply_multi_threshold), un pixel égal à t passe dans la
+ * classe supérieure. Avec k = 1, le seuil est celui de calculate_otsu_threshold.
+ *
+ * @param img Image en niveaux de gris.
+ * @param num_thresholds Nombre de seuils k (1 à MULTI_OTSU_MAX_THRESHOLDS).
+ * @param thresholds Reçoit les k seuils, dans l'ordre croissant (alloué par l'appelant).
+ * @return 0 en cas de succès, -1 en cas d'erreur.
+ */
+int calculate_multi_otsu_thresholds(const Image *img, int num_thresholds, int *thresholds);
+
 
 #endif // HISTOGRAM_H
\ No newline at end of file
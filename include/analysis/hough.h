@@ -1,7 +1,214 @@
 #ifndef HOUGH_H
 #define HOUGH_H
 
+#include <stdint.h>
 #include "core/image.h"
+#include "filters/predefined_filters.h"
+
+// Nombre maximal de droites dessinées par hough_transform
+#define HOUGH_MAX_LINES 64
+// Rayon de suppression des non-maxima utilisé par hough_transform
+#define HOUGH_NMS_RADIUS 5
+
+/**
+ * @struct HoughPoint
+ * @brief Coordonnées d'un pixel de contour.
+ */
+typedef struct {
+    int x;
+    int y;
+} HoughPoint;
+
+/**
+ * @struct HoughTrigTable
+ * @brief Tables de cos/sin précalculées pour les theta_dim angles (pas de 180/theta_dim degrés).
+ *
+ * Les versions en virgule fixe (Q16.16) permettent un vote en arithmétique
+ * entière : rho * 65536 = x * cos_fx + y * sin_fx.
+ */
+typedef struct {
+    int theta_dim;
+    double *cos_t;
+    double *sin_t;
+    int32_t *cos_fx;
+    int32_t *sin_fx;
+} HoughTrigTable;
+
+/**
+ * @struct HoughAccumulator
+ * @brief Accumulateur de Hough (rho, theta), rangé par theta.
+ *
+ * votes[t * rho_dim + r] : chaque colonne theta est contiguë, le vote d'un
+ * point pour tous les angles écrit donc theta_dim colonnes l'une après l'autre.
+ * L'indice r correspond à rho = r - rho_offset.
+ */
+typedef struct {
+    int rho_dim;
+    int theta_dim;
+    double rho_offset;  // Demi-diagonale de l'image
+    int *votes;
+} HoughAccumulator;
+
+/**
+ * @brief Répartition du vote sur le pool de threads.
+ *
+ * Les deux découpages donnent exactement les mêmes votes (comptes entiers).
+ */
+typedef enum {
+    HOUGH_PARALLEL_AUTO = 0, // Choix selon la taille de l'accumulateur
+    HOUGH_PARALLEL_POINTS,   // Points répartis, un accumulateur par thread, somme à la fin
+    HOUGH_PARALLEL_THETA     // Angles répartis : chaque thread possède ses colonnes, sans somme
+} HoughParallelMode;
+
+/**
+ * @struct HoughOptions
+ * @brief Paramètres du vote.
+ */
+typedef struct {
+    int theta_dim;       // Nombre d'angles sur [0, 180[ degrés (180 par défaut)
+    int use_fixed_point; // 1 : vote en virgule fixe Q16.16 (voir hough_accumulate)
+    HoughParallelMode parallel_mode;
+    // Vote contraint par l'orientation : si gradient != NULL (mêmes dimensions
+    // que l'image de contours), chaque point ne vote que pour les angles à
+    // moins de gradient_tolerance degrés de la direction de son gradient.
+    const GradientField *gradient;
+    double gradient_tolerance;
+} HoughOptions;
+
+/**
+ * @brief Remplit des options par défaut (180 angles, vote en double, sans gradient).
+ */
+void hough_default_options(HoughOptions *opts);
+
+/**
+ * @brief Compacte les pixels de contour (valeur > 0) dans une liste de coordonnées.
+ *
+ * @param edge_img Image binaire des contours.
+ * @param out_points Reçoit le tableau de points (à libérer avec free()).
+ * @return Le nombre de points, ou -1 en cas d'erreur.
+ */
+int hough_collect_edge_points(const Image *edge_img, HoughPoint **out_points);
+
+/**
+ * @brief Précalcule les tables trigonométriques pour theta_dim angles.
+ * @return Les tables (à libérer avec hough_trig_table_free()), ou NULL en cas d'erreur.
+ */
+HoughTrigTable *hough_trig_table_create(int theta_dim);
+
+/**
+ * @brief Libère des tables trigonométriques.
+ */
+void hough_trig_table_free(HoughTrigTable *table);
+
+/**
+ * @brief Vote dans l'espace (rho, theta) pour une image de contours.
+ *
+ * Les pixels de contour sont d'abord compactés en liste, puis chaque point
+ * vote pour tous les angles à l'aide des tables précalculées (aucun appel
+ * à cos/sin dans la boucle de vote). En double, les votes sont identiques
+ * à ceux de la version historique (rho tronqué vers zéro après décalage).
+ * En virgule fixe, rho est arrondi par défaut à 2^-16 près : quelques votes
+ * peuvent passer dans la case voisine lorsque rho tombe sur un entier.
+ *
+ * Avec opts->gradient, chaque point vote seulement sur ±gradient_tolerance
+ * degrés autour de l'orientation de son gradient (normale de la droite) :
+ * environ 180 / (2 * tolérance) fois moins de votes, et des pics plus nets.
+ * Les points de gradient nul ne votent pas.
+ *
+ * Le vote est réparti sur le pool de threads (voir HoughParallelMode) :
+ * en automatique, les points sont répartis avec un accumulateur privé par
+ * thread tant que ces copies restent petites (4 Mo au total), sinon les
+ * angles sont répartis. Le résultat ne dépend pas du nombre de threads.
+ *
+ * @param edge_img Image binaire des contours.
+ * @param opts Options (NULL pour les valeurs par défaut).
+ * @return L'accumulateur (à libérer avec hough_accumulator_free()), ou NULL en cas d'erreur.
+ */
+HoughAccumulator *hough_accumulate(const Image *edge_img, const HoughOptions *opts);
+
+/**
+ * @brief Libère un accumulateur.
+ */
+void hough_accumulator_free(HoughAccumulator *acc);
+
+/**
+ * @brief Image de l'accumulateur (theta en abscisse, rho en ordonnée), normalisée sur 0-255.
+ */
+Image *hough_accumulator_image(const HoughAccumulator *acc);
+
+/**
+ * @struct HoughLine
+ * @brief Droite détectée : x cos(theta) + y sin(theta) = rho.
+ */
+typedef struct {
+    double rho;    // En pixels, peut être négatif
+    double theta;  // En radians, sur [0, PI[
+    int votes;
+} HoughLine;
+
+/**
+ * @brief Extrait les pics de l'accumulateur.
+ *
+ * Une case est un pic si elle atteint le seuil et qu'aucune case de la
+ * fenêtre (2 * nms_radius + 1)² centrée sur elle n'a plus de votes (à
+ * égalité, la première dans l'ordre (theta, rho) l'emporte). La fenêtre
+ * est cyclique en theta : au-delà de 180°, elle reprend à 0° avec rho
+ * opposé, une droite proche de la verticale ne donne donc qu'un pic. Seuls les
+ * max_lines pics les plus votés sont gardés, via un tas de taille bornée :
+ * le coût est O(cases * log(max_lines)), sans trier tous les pics.
+ *
+ * @param acc L'accumulateur.
+ * @param threshold Votes minimaux.
+ * @param nms_radius Rayon de suppression des non-maxima (0 : seuil seul).
+ * @param max_lines Nombre maximal de droites (taille de out_lines).
+ * @param out_lines Tableau de max_lines éléments, rempli par votes décroissants.
+ * @return Le nombre de droites écrites, ou -1 en cas d'erreur.
+ */
+int hough_find_peaks(const HoughAccumulator *acc, int threshold, int nms_radius,
+                     int max_lines, HoughLine *out_lines);
+
+/**
+ * @brief Dessine des droites en blanc sur une image 1 canal (sur toute sa largeur ou hauteur).
+ */
+void hough_draw_lines(Image *img, const HoughLine *lines, int count);
+
+/**
+ * @struct HoughSegment
+ * @brief Segment de droite détecté (extrémités incluses).
+ */
+typedef struct {
+    int x1, y1;
+    int x2, y2;
+    int votes;  // Votes de la case (rho, theta) au moment de la détection
+} HoughSegment;
+
+/**
+ * @brief Transformée de Hough probabiliste progressive (segments).
+ *
+ * Les points de contour sont tirés dans un ordre aléatoire (graine fixe :
+ * le résultat est reproductible). Chaque point tiré vote ; dès qu'une case
+ * atteint le seuil, on suit la droite correspondante à partir du point dans
+ * l'image des contours, en tolérant des trous de max_gap pixels. Les pixels
+ * du segment sont retirés des points restants et leurs votes annulés : un
+ * segment n'est détecté qu'une fois, et la plupart des pixels des lignes
+ * longues ne votent jamais.
+ *
+ * @param edge_img Image binaire des contours.
+ * @param opts Options (theta_dim ; NULL pour les valeurs par défaut).
+ * @param threshold Votes nécessaires pour déclarer une droite.
+ * @param min_length Longueur minimale d'un segment retenu (en pixels).
+ * @param max_gap Trou maximal toléré entre deux pixels d'un même segment.
+ * @param out_segments Reçoit le tableau des segments (à libérer avec free()).
+ * @param out_votes Si non NULL, reçoit le nombre de points ayant voté.
+ * @return Le nombre de segments, ou -1 en cas d'erreur.
+ */
+int hough_probabilistic(const Image *edge_img, const HoughOptions *opts, int threshold,
+                        int min_length, int max_gap, HoughSegment **out_segments, long *out_votes);
+
+/**
+ * @brief Dessine des segments (Bresenham) en blanc sur une image 1 canal.
+ */
+void hough_draw_segments(Image *img, const HoughSegment *segments, int count);
 
 /**
  * @brief Applique la Transformée de Hough pour détecter des lignes.
@@ -9,7 +216,8 @@
  * Cette fonction effectue 3 tâches :
  * 1. Vote dans l'espace de Hough (Accumulateur rho/theta).
  * 2. Génère une image visuelle de l'accumulateur (pour le debug/visualisation).
- * 3. (Optionnel) Dessine les lignes détectées les plus fortes sur une copie de l'image.
+ * 3. Dessine les lignes détectées les plus fortes (au plus HOUGH_MAX_LINES pics,
+ *    après suppression des non-maxima, voir hough_find_peaks) sur une copie de l'image.
  * 
  * @param edge_img Image binaire des contours (issue de Sobel + Threshold).
  * @param accumulator_view Pointeur pour récupérer l'image de l'accumulateur (peut être NULL).
@@ -18,4 +226,12 @@
  */
 Image *hough_transform(const Image *edge_img, Image **accumulator_view, int threshold);
 
-#endif
\ No newline at end of file
+/**
+ * @brief Variante de hough_transform avec options de vote (gradient, virgule fixe...).
+ *
+ * @param opts Options de vote (NULL : identique à hough_transform).
+ */
+Image *hough_transform_ex(const Image *edge_img, Image **accumulator_view, int threshold,
+                          const HoughOptions *opts);
+
+#endif
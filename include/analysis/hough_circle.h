@@ -0,0 +1,66 @@
+#ifndef HOUGH_CIRCLE_H
+#define HOUGH_CIRCLE_H
+
+#include "core/image.h"
+
+/**
+ * @struct HoughCircle
+ * @brief Cercle détecté.
+ */
+typedef struct {
+    int x;       // Centre
+    int y;
+    int radius;
+    int votes;   // Pixels de contour à distance 'radius' du centre (pic de l'histogramme)
+} HoughCircle;
+
+/**
+ * @struct HoughCircleParams
+ * @brief Paramètres de la détection de cercles.
+ */
+typedef struct {
+    int min_radius;         // Rayons cherchés : [min_radius, max_radius]
+    int max_radius;
+    double edge_threshold;  // Norme minimale du gradient de Sobel pour un pixel de contour
+    int center_threshold;   // Votes minimaux d'un centre candidat
+    double min_support;     // Fraction minimale du périmètre couverte par des contours (0-1)
+    int min_distance;       // Distance minimale entre deux centres retenus
+    int max_circles;        // Nombre maximal de cercles retournés
+} HoughCircleParams;
+
+/**
+ * @brief Remplit des paramètres par défaut pour une plage de rayons.
+ *
+ * Seuil de contour 100, 20 votes par centre, 40% du périmètre, centres
+ * distants d'au moins min_radius, 64 cercles au plus.
+ */
+void hough_circle_default_params(HoughCircleParams *params, int min_radius, int max_radius);
+
+/**
+ * @brief Détecte des cercles par une transformée de Hough en deux étapes.
+ *
+ * 1. Accumulateur des centres (2D, taille de l'image) : chaque pixel de
+ *    contour vote le long d'un seul rayon, dans la direction de son gradient
+ *    (et la direction opposée, le contraste du cercle étant inconnu), pour
+ *    les distances [min_radius, max_radius].
+ * 2. Pour chaque centre candidat (maximum local, du plus voté au moins voté),
+ *    histogramme des distances des pixels de contour proches : le rayon est
+ *    le pic de l'histogramme. Les centres sont examinés dans cet ordre pour
+ *    écarter ceux trop proches d'un cercle déjà retenu (min_distance).
+ * Aucun accumulateur 3D (x, y, r) n'est alloué : la mémoire est celle de
+ * l'image plus un histogramme de max_radius cases.
+ *
+ * @param src L'image en niveaux de gris (pas une image de contours).
+ * @param params Les paramètres (voir hough_circle_default_params).
+ * @param out_circles Reçoit le tableau des cercles, par HoughCircle::votes décroissants
+ *        (à égalité, par votes du centre décroissants) ; à libérer avec free().
+ * @return Le nombre de cercles, ou -1 en cas d'erreur.
+ */
+int hough_circles(const Image *src, const HoughCircleParams *params, HoughCircle **out_circles);
+
+/**
+ * @brief Dessine des cercles en blanc sur une image 1 canal (algorithme du point milieu).
+ */
+void hough_draw_circles(Image *img, const HoughCircle *circles, int count);
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef LABELING_H
+#define LABELING_H
+
+#include "core/image.h"
+#include <stdint.h>
+
+/**
+ * @struct LabelImage
+ * @brief Image d'étiquettes 32 bits (0 = fond, 1..n = composante ou région).
+ */
+typedef struct {
+    int width;
+    int height;
+    uint32_t *labels; // width * height étiquettes, ligne par ligne
+} LabelImage;
+
+/**
+ * @brief Statistiques d'une composante, calculées pendant l'étiquetage.
+ */
+typedef struct {
+    uint32_t label;        // Étiquette de la composante (1..n)
+    long area;             // Nombre de pixels
+    int min_x, min_y;      // Boîte englobante (bornes incluses)
+    int max_x, max_y;
+    double centroid_x;     // Centre de gravité
+    double centroid_y;
+    double mean_intensity; // Moyenne de l'image d'intensité sur la composante
+} ComponentStats;
+
+/**
+ * @brief Alloue une image d'étiquettes initialisée à 0.
+ * @return L'image, ou NULL en cas d'erreur. À libérer avec label_image_free().
+ */
+LabelImage *label_image_create(int width, int height);
+
+/**
+ * @brief Libère une image d'étiquettes.
+ */
+void label_image_free(LabelImage *labels);
+
+/**
+ * @brief Étiquette les composantes connexes d'un masque binaire.
+ *
+ * Algorithme en deux passes avec union-find (racine = plus petite étiquette) :
+ *  - en 8-connexité, le balayage se fait par blocs 2x2 (à la Grana) : les
+ *    pixels allumés d'un bloc sont toujours connexes, une seule étiquette
+ *    provisoire par bloc suffit et le nombre d'unions est divisé d'autant ;
+ *  - en 4-connexité, les diagonales d'un bloc ne sont pas connexes : le
+ *    balayage se fait pixel par pixel.
+ * La première passe est découpée en bandes horizontales traitées en
+ * parallèle, chacune avec sa plage d'étiquettes ; les jonctions entre bandes
+ * sont ensuite fusionnées. La seconde passe écrit les étiquettes finales et
+ * accumule les statistiques.
+ *
+ * Les étiquettes finales suivent l'ordre de balayage et ne dépendent pas du
+ * nombre de threads.
+ *
+ * @param mask Masque en niveaux de gris (pixel != 0 = objet).
+ * @param intensity Image utilisée pour mean_intensity (mêmes dimensions, 1 canal),
+ *                  ou NULL pour utiliser le masque lui-même.
+ * @param connectivity 4 ou 8.
+ * @param out_labels Reçoit l'image d'étiquettes (à libérer avec label_image_free()).
+ * @param out_stats Reçoit un tableau de n statistiques (stats[i] décrit l'étiquette i + 1,
+ *                  à libérer avec free()), ou NULL si inutile.
+ * @return Le nombre de composantes n, ou -1 en cas d'erreur.
+ */
+int label_components(const Image *mask, const Image *intensity, int connectivity,
+                     LabelImage **out_labels, ComponentStats **out_stats);
+
+/**
+ * @brief Convertit une image d'étiquettes en image en niveaux de gris pour affichage.
+ *
+ * Le fond reste noir ; chaque étiquette reçoit un niveau de gris (entre 64
+ * et 255) qui varie fortement d'une étiquette à la suivante.
+ *
+ * @return L'image, ou NULL en cas d'erreur.
+ */
+Image *label_image_to_image(const LabelImage *labels);
+
+#endif // LABELING_H
@@ -2,6 +2,7 @@
 #define SEGMENTATION_H
 
 #include "core/image.h"
+#include "analysis/labeling.h"
 
 /**
  * @brief Applique une croissance de région à partir d'un germe.
@@ -14,4 +15,55 @@
  */
 Image *region_growing(const Image *src, int seed_x, int seed_y, int tolerance);
 
+/**
+ * @brief Germe d'une croissance de régions multiple.
+ */
+typedef struct {
+    int x;
+    int y;
+} RegionSeed;
+
+/**
+ * @brief Référence à laquelle un pixel candidat est comparé.
+ */
+typedef enum {
+    REGION_PREDICATE_SEED, // Valeur du germe (comme region_growing)
+    REGION_PREDICATE_MEAN  // Moyenne courante de la région, mise à jour à chaque ajout
+} RegionPredicate;
+
+/**
+ * @brief Croissance de régions à germes multiples (Seeded Region Growing).
+ *
+ * Toutes les régions croissent en même temps, en une seule passe : les
+ * pixels voisins d'une région attendent dans une file à 256 niveaux
+ * (priorité = écart à la référence de la région), et le pixel le plus
+ * proche de sa région est toujours traité en premier. Au moment de son
+ * extraction, un pixel rejoint la région voisine dont la référence est la
+ * plus proche, si l'écart reste dans la tolérance (4-connexité).
+ *
+ * Les pixels non atteints gardent l'étiquette 0.
+ *
+ * @param src Image source (niveaux de gris).
+ * @param seeds Germes ; la région i reçoit l'étiquette i + 1.
+ * @param num_seeds Nombre de germes.
+ * @param tolerance Écart maximal d'intensité avec la référence de la région.
+ * @param predicate Référence utilisée (germe ou moyenne courante).
+ * @param out_labels Reçoit l'image d'étiquettes (à libérer avec label_image_free()).
+ * @return Le nombre de pixels étiquetés, ou -1 en cas d'erreur.
+ */
+long region_growing_multi(const Image *src, const RegionSeed *seeds, int num_seeds, int tolerance,
+                          RegionPredicate predicate, LabelImage **out_labels);
+
+/**
+ * @brief Charge une liste de germes depuis un fichier texte.
+ *
+ * Format : une paire "x y" par germe, séparées par des espaces ou des
+ * retours à la ligne.
+ *
+ * @param path Chemin du fichier.
+ * @param out_seeds Reçoit le tableau de germes (à libérer avec free()).
+ * @return Le nombre de germes lus, ou -1 en cas d'erreur.
+ */
+int load_region_seeds(const char *path, RegionSeed **out_seeds);
+
 #endif
\ No newline at end of file
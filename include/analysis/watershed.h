@@ -0,0 +1,29 @@
+#ifndef WATERSHED_H
+#define WATERSHED_H
+
+#include "core/image.h"
+#include "analysis/labeling.h"
+
+/**
+ * @brief Ligne de partage des eaux par inondation à partir de marqueurs (Meyer).
+ *
+ * Les bassins partent des marqueurs et montent ensemble niveau par niveau :
+ * les pixels de la frontière attendent dans une file hiérarchique à 256
+ * niveaux (un FIFO par niveau de gris), ce qui donne un coût O(1) par pixel
+ * sur une image 8 bits, là où un tas coûte O(log n). Un pixel prend
+ * l'étiquette du bassin qui l'atteint en premier ; sa priorité est
+ * max(gradient, niveau courant), pour que l'eau ne redescende jamais.
+ *
+ * Tous les pixels connexes (4-connexité) à un marqueur sont étiquetés :
+ * le résultat est une partition sans lignes de crête explicites, les
+ * frontières se lisent entre étiquettes différentes.
+ *
+ * @param gradient Image de relief (niveaux de gris), typiquement la sortie
+ *                 de la détection de contours Sobel ou du gradient morphologique.
+ * @param markers Étiquettes des marqueurs (0 = à inonder), aux dimensions du
+ *                gradient. Complétée en place.
+ * @return 0 en cas de succès, -1 en cas d'erreur.
+ */
+int watershed(const Image *gradient, LabelImage *markers);
+
+#endif // WATERSHED_H
@@ -23,6 +23,8 @@ typedef struct {
     const char *histogram_output_path;
     int blur_kernel_size;
     int gaussian_blur_kernel_size;
+    double gaussian_sigma;   // Flou Gaussien récursif, 0 si inactif
+    const char *kernel_path; // Noyau de convolution personnalisé (fichier texte)
     bool apply_sobel;
     bool apply_sharpen;
     bool apply_equalization;
@@ -31,6 +33,8 @@ typedef struct {
     const char *fft_spectrum_path;
     int fft_lowpass_radius;  
     int fft_highpass_radius;
+    bool fft_float;          // Si true, FFT en simple précision (SoA + SIMD)
+    int fft_tile_size;       // Si > 0, filtrage FFT par blocs de cette taille
     bool apply_prewitt;    
     bool apply_roberts;    
     int threshold_value;  
@@ -48,6 +52,10 @@ typedef struct {
 
     bool apply_invert;
     bool resize_bilinear; // Si true -> bilinéaire, sinon voisin
+    bool resize_area;     // Si true -> moyenne de surface (réduction)
+    bool resize_bicubic;  // Si true -> bicubique
+    bool resize_lanczos;  // Si true -> Lanczos-3
+    int pyramid_levels;   // Si > 0, sauvegarde les pyramides gaussienne et laplacienne
     int local_eq_window;  // Taille fenêtre, 0 si inactif
     
     // Logique
@@ -60,6 +68,11 @@ typedef struct {
 
     // Dans Arguments :
     double rotation_angle;
+    bool rotate_bilinear; // Si true -> rotation bilinéaire, sinon voisin
+    bool rotate_expand;   // Si true -> cadre agrandi pour contenir toute l'image
+    bool rotate_shear;    // Si true -> rotation par trois cisaillements
+    int warp_matrix_size;   // 6 (affine), 9 (perspective), 0 si inactif
+    double warp_matrix[9];
     
     // Pour l'emphasis
     int fft_emphasis_radius;
@@ -68,10 +81,25 @@ typedef struct {
     // Dans Arguments
     bool apply_laplacian;
     int hough_threshold; // Si > 0, active Hough
+    double hough_gradient_tolerance; // Si > 0, vote contraint par le gradient (± degrés)
+    int hough_p_threshold;  // Si > 0, active Hough probabiliste (segments)
+    int hough_p_min_length;
+    int hough_p_max_gap;
+    int hough_circle_min_radius; // Si > 0, active la détection de cercles
+    int hough_circle_max_radius;
     bool use_otsu; // Si true, utiliser Otsu pour le seuillage
+    const char *adaptive_method; // "bradley" ou "sauvola" : seuillage adaptatif (NULL = désactivé)
+    int adaptive_window;
+    double adaptive_k;
+    int otsu_levels; // Si > 0, Otsu multi-niveaux avec ce nombre de seuils
     int seed_x;
     int seed_y;
     int region_tolerance; // Si > 0, active region growing
+    const char *region_seeds_path; // Fichier de germes "x y" : croissance de régions multiple
+    int region_seeds_tolerance;
+    bool region_mean; // Prédicat sur la moyenne courante de la région plutôt que sur le germe
+    const char *watershed_seeds_path; // Fichier de marqueurs "x y" : ligne de partage des eaux
+    int label_connectivity; // 4 ou 8 : étiquetage des composantes connexes (0 = désactivé)
     // Dans Arguments
     int morph_open_size;
     int morph_close_size;
@@ -80,6 +108,8 @@ typedef struct {
     // ou ajouter --erode / --dilate pour être plus clair. Ajoutons-les :
     int morph_erode_size;
     int morph_dilate_size;
+
+    int num_threads; // Nombre de threads du pool (0 = automatique)
     
 } Arguments;
 
@@ -0,0 +1,23 @@
+#ifndef CPU_H
+#define CPU_H
+
+/**
+ * @brief Jeux d'instructions SIMD utilisables par les noyaux vectorisés.
+ */
+typedef enum {
+    SIMD_NONE = 0,  // Code scalaire uniquement
+    SIMD_SSE2 = 1,  // Vecteurs de 4 floats
+    SIMD_AVX2 = 2   // Vecteurs de 8 floats
+} SimdLevel;
+
+/**
+ * @brief Détecte (une seule fois) le meilleur jeu d'instructions disponible.
+ *
+ * La variable d'environnement IMGPROC_SIMD ("none", "sse2", "avx2") permet
+ * de plafonner le niveau utilisé, par exemple pour comparer les chemins.
+ *
+ * @return Le niveau SIMD à utiliser.
+ */
+SimdLevel cpu_simd_level(void);
+
+#endif // CPU_H
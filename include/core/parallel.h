@@ -0,0 +1,58 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+/**
+ * @brief Fonction de travail exécutée par un thread du pool sur une plage d'indices.
+ *
+ * @param ctx Contexte partagé fourni à parallel_for (lecture seule, ou zones disjointes).
+ * @param begin Premier indice de la plage (inclus).
+ * @param end Dernier indice de la plage (exclu).
+ * @param thread_id Numéro du morceau (0..nb_threads-1). Sert à choisir un buffer
+ *                  de travail propre au thread, alloué par l'appelant.
+ */
+typedef void (*ParallelRangeFn)(void *ctx, int begin, int end, int thread_id);
+
+/**
+ * @brief Fixe le nombre de threads utilisés par le pool.
+ *
+ * Par défaut, la variable d'environnement IMGPROC_THREADS est lue, sinon
+ * le nombre de coeurs en ligne est utilisé.
+ *
+ * @param num_threads Nombre de threads souhaité (1 = exécution séquentielle).
+ */
+void parallel_set_num_threads(int num_threads);
+
+/**
+ * @brief Retourne le nombre de threads configuré pour le pool.
+ */
+int parallel_get_num_threads(void);
+
+/**
+ * @brief Calcule le nombre de morceaux à utiliser pour une boucle donnée.
+ *
+ * Permet à l'appelant d'allouer un buffer de travail par thread avant
+ * d'appeler parallel_for. Retourne toujours 1 si l'appel est fait depuis
+ * un thread du pool (pas de parallélisme imbriqué).
+ *
+ * @param count Nombre total d'itérations.
+ * @param min_chunk Nombre minimal d'itérations par thread (évite de paralléliser
+ *                  des boucles trop courtes).
+ * @return Le nombre de threads à utiliser (>= 1).
+ */
+int parallel_thread_count(int count, int min_chunk);
+
+/**
+ * @brief Exécute fn sur [0, count) découpé en num_chunks plages contiguës.
+ *
+ * Le thread appelant traite le morceau 0, les autres morceaux sont confiés
+ * aux threads du pool (créés à la première utilisation puis réutilisés).
+ * La fonction ne retourne que lorsque tous les morceaux sont terminés.
+ *
+ * @param count Nombre total d'itérations.
+ * @param num_chunks Nombre de morceaux (obtenu via parallel_thread_count).
+ * @param fn La fonction de travail.
+ * @param ctx Le contexte transmis à fn.
+ */
+void parallel_for(int count, int num_chunks, ParallelRangeFn fn, void *ctx);
+
+#endif // PARALLEL_H
@@ -7,10 +7,27 @@ typedef struct {
     double imag; // Partie imaginaire (b)
 } Complex;
 
-// Fonctions utilitaires pour l'arithmétique des nombres complexes
-Complex complex_add(Complex a, Complex b);
-Complex complex_sub(Complex a, Complex b);
-Complex complex_mul(Complex a, Complex b);
+// Fonctions utilitaires pour l'arithmétique des nombres complexes.
+// Elles sont "inline" : appelées dans les boucles internes de la FFT,
+// elles ne doivent pas coûter un appel de fonction.
+static inline Complex complex_add(Complex a, Complex b) {
+    Complex result = {a.real + b.real, a.imag + b.imag};
+    return result;
+}
+
+static inline Complex complex_sub(Complex a, Complex b) {
+    Complex result = {a.real - b.real, a.imag - b.imag};
+    return result;
+}
+
+// Multiplication : (a + ib) * (c + id) = (ac - bd) + i(ad + bc)
+static inline Complex complex_mul(Complex a, Complex b) {
+    Complex result;
+    result.real = a.real * b.real - a.imag * b.imag;
+    result.imag = a.real * b.imag + a.imag * b.real;
+    return result;
+}
+
 double complex_magnitude(Complex c);
 
-#endif // COMPLEX_H
\ No newline at end of file
+#endif // COMPLEX_H
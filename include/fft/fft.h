@@ -3,6 +3,35 @@
 
 #include "core/image.h"
 #include "fft/complex.h"
+#include "fft/fft_f32.h"
+
+/**
+ * @brief Précision de calcul de la FFT 2D.
+ *
+ * FFT_PRECISION_FLOAT calcule la transformée en simple précision sur des
+ * tableaux réels/imaginaires séparés (SoA) avec des papillons SSE2/AVX2
+ * (voir fft/fft_f32.h). Le spectre reste en simple précision de bout en
+ * bout avec fft2d_f32_image, freq_filter_apply_plane et ifft2d_f32_image.
+ * fft2d_ex / ifft2d_ex ne sont qu'une couche de compatibilité : elles
+ * recopient ce spectre dans une matrice de Complex (double), pour les
+ * traitements qui en ont besoin (spectre affiché, détection des pics...).
+ *
+ * Bornes d'erreur par rapport au chemin double (radix-2, mesurées sur
+ * lena/circuit en 512x512 et sur du bruit uniforme jusqu'à 4096x4096) :
+ * - erreur relative RMS sur le spectre : environ 1e-7 (croît en log2(N),
+ *   N = largeur * hauteur ; la borne théorique est de l'ordre de
+ *   epsilon_float * log2(N), soit 1.4e-6 pour 4096x4096) ;
+ * - aller-retour FFT/IFFT : écart absolu inférieur à 2e-4 niveau de gris ;
+ *   ifft2d_ex ajoute une marge de 1e-3 avant la troncature, l'image 8 bits
+ *   d'origine est donc retrouvée exactement.
+ * Une valeur filtrée qui tombe à moins de 1e-3 sous un entier peut ainsi
+ * différer d'un niveau entre les deux chemins.
+ * Pour des images 8 bits, la simple précision est donc suffisante.
+ */
+typedef enum {
+    FFT_PRECISION_DOUBLE = 0,
+    FFT_PRECISION_FLOAT = 1
+} FFTPrecision;
 
 // Structure pour un seul filtre notch
 typedef struct {
@@ -11,6 +40,12 @@ typedef struct {
     int radius;
 } NotchFilter;
 
+/**
+ * @brief Dimension du spectre calculé par fft2d pour une dimension d'image.
+ * @return La plus petite puissance de 2 supérieure ou égale à n.
+ */
+int fft_padded_size(int n);
+
 /**
  * @brief Calcule la Transformée de Fourier Rapide (FFT) 2D d'une image.
  *
@@ -36,6 +71,57 @@ Complex **fft2d(const Image *src, int *out_width, int *out_height);
  */
 Image *ifft2d(Complex **fft_data, int width, int height);
 
+/**
+ * @brief FFT 2D simple précision d'une image, sans conversion en Complex.
+ *
+ * L'image est recopiée dans les parties réelles d'une matrice SoA complétée
+ * par des zéros jusqu'aux puissances de 2 (comme fft2d), puis transformée.
+ *
+ * @param src L'image source en niveaux de gris.
+ * @return Le spectre (à libérer avec split_plane_free()), ou NULL en cas d'erreur.
+ */
+SplitComplexPlane *fft2d_f32_image(const Image *src);
+
+/**
+ * @brief FFT 2D inverse simple précision, vers une image.
+ *
+ * Normalise par width * height, ajoute FLOAT_TRUNCATION_GUARD et écrête
+ * dans [0, 255], comme ifft2d_ex.
+ *
+ * @param plane Le spectre (modifié en place : il contient ensuite l'inverse).
+ * @return Une nouvelle image plane->width x plane->height, ou NULL en cas d'erreur.
+ */
+Image *ifft2d_f32_image(SplitComplexPlane *plane);
+
+/**
+ * @brief Variante de fft2d avec choix de la précision de calcul.
+ *
+ * En simple précision, couche de compatibilité sur fft2d_f32_image : le
+ * spectre float est recopié dans une matrice de Complex (double). Préférer
+ * fft2d_f32_image quand la matrice de Complex n'est pas nécessaire.
+ *
+ * @param src L'image source en niveaux de gris.
+ * @param out_width Pointeur pour stocker la largeur de la matrice de sortie.
+ * @param out_height Pointeur pour stocker la hauteur de la matrice de sortie.
+ * @param precision FFT_PRECISION_DOUBLE (identique à fft2d) ou FFT_PRECISION_FLOAT.
+ * @return La matrice du spectre (à libérer avec free_fft_data()), ou NULL en cas d'erreur.
+ */
+Complex **fft2d_ex(const Image *src, int *out_width, int *out_height, FFTPrecision precision);
+
+/**
+ * @brief Variante de ifft2d avec choix de la précision de calcul.
+ *
+ * En simple précision, fft_data est recopiée en float puis transformée par
+ * ifft2d_f32_image ; fft_data n'est pas modifiée.
+ *
+ * @param fft_data La matrice de nombres complexes.
+ * @param width La largeur de la matrice.
+ * @param height La hauteur de la matrice.
+ * @param precision FFT_PRECISION_DOUBLE (identique à ifft2d) ou FFT_PRECISION_FLOAT.
+ * @return Une nouvelle image en niveaux de gris, ou NULL en cas d'erreur.
+ */
+Image *ifft2d_ex(Complex **fft_data, int width, int height, FFTPrecision precision);
+
 /**
  * @brief Libère la mémoire allouée pour une matrice de données FFT.
  *
@@ -86,7 +172,19 @@ void fft_lowpass_filter(Complex **fft_data, int width, int height, int radius);
  */
 void fft_highpass_filter(Complex **fft_data, int width, int height, int radius);
 
-
+/**
+ * @brief Met à zéro un disque de fréquences autour de (u,v) et de son symétrique (-u,-v).
+ *
+ * Seule la boîte englobante des deux disques est parcourue. Pour combiner
+ * plusieurs notch avec d'autres filtres, voir FreqFilter (fft/freq_filter.h).
+ *
+ * @param fft_data La matrice de nombres complexes (sera modifiée en place).
+ * @param width La largeur de la matrice.
+ * @param height La hauteur de la matrice.
+ * @param u Abscisse du pic, relative au centre du spectre décalé.
+ * @param v Ordonnée du pic, relative au centre du spectre décalé.
+ * @param radius Le rayon du disque supprimé.
+ */
 void fft_notch_filter(Complex **fft_data, int width, int height, int u, int v, int radius);
 
 /**
@@ -94,6 +192,9 @@ void fft_notch_filter(Complex **fft_data, int width, int height, int u, int v, i
  *
  * Analyse le spectre pour détecter les pics de bruit (points brillants isolés)
  * et applique automatiquement des filtres notch pour les supprimer.
+ * La médiane est obtenue par sélection en O(n) ; seuls les maxima locaux
+ * (3x3) au-dessus du seuil sont candidats, puis les pics voisins (à moins
+ * d'un rayon de notch) et les paires symétriques sont regroupés.
  *
  * @param fft_data La matrice de nombres complexes (sera modifiée en place).
  * @param width La largeur de la matrice.
@@ -0,0 +1,87 @@
+#ifndef FFT_F32_H
+#define FFT_F32_H
+
+/**
+ * @brief Marge ajoutée à une valeur calculée en simple précision avant sa
+ * troncature en niveau de gris.
+ *
+ * Une somme entière calculée en float peut tomber juste sous l'entier
+ * (99.9999) et perdre un niveau à la troncature. Utilisée par ifft2d_ex,
+ * la FFT par blocs et les moteurs séparable et FFT de apply_convolution_ex.
+ */
+#define FLOAT_TRUNCATION_GUARD 1e-3f
+
+/**
+ * @struct SplitComplexPlane
+ * @brief Matrice de nombres complexes en simple précision, stockée en "SoA".
+ *
+ * Les parties réelles et imaginaires sont dans deux tableaux séparés
+ * (ligne par ligne, width * height floats chacun). Ce format permet de
+ * charger 4 (SSE) ou 8 (AVX2) parties réelles d'un coup, sans mélange.
+ */
+typedef struct {
+    int width;   // Doit être une puissance de 2
+    int height;  // Doit être une puissance de 2
+    float *re;   // Parties réelles
+    float *im;   // Parties imaginaires
+} SplitComplexPlane;
+
+/**
+ * @brief Alloue une matrice SoA initialisée à zéro.
+ *
+ * @param width Largeur (puissance de 2).
+ * @param height Hauteur (puissance de 2).
+ * @return La matrice, ou NULL en cas d'erreur. À libérer avec split_plane_free().
+ */
+SplitComplexPlane *split_plane_create(int width, int height);
+
+/**
+ * @brief Libère une matrice SoA.
+ */
+void split_plane_free(SplitComplexPlane *plane);
+
+/**
+ * @brief FFT 2D en place, en simple précision (Cooley-Tukey itératif radix-2).
+ *
+ * Les papillons sont vectorisés en SSE2 ou AVX2 selon le processeur
+ * (voir cpu_simd_level). Les lignes sont transformées en vectorisant sur
+ * les papillons d'un même étage, les colonnes en vectorisant sur la largeur
+ * (deux lignes entières par papillon), sans transposition.
+ *
+ * L'inverse n'est pas normalisée : le résultat doit être divisé par
+ * width * height par l'appelant.
+ *
+ * @param plane La matrice à transformer (modifiée en place).
+ * @param inverse 0 pour la FFT directe, 1 pour l'inverse.
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int fft2d_f32_inplace(SplitComplexPlane *plane, int inverse);
+
+/**
+ * @brief Plan FFT 2D réutilisable pour une taille donnée.
+ *
+ * Contient les permutations et facteurs de rotation des lignes et colonnes,
+ * dans les deux sens. Un même plan peut être exécuté simultanément par
+ * plusieurs threads sur des matrices différentes.
+ */
+typedef struct FFTF32Plan FFTF32Plan;
+
+/**
+ * @brief Prépare un plan pour des matrices width x height (puissances de 2).
+ * @return Le plan, ou NULL en cas d'erreur. À libérer avec fft_f32_plan_free().
+ */
+FFTF32Plan *fft_f32_plan_create(int width, int height);
+
+/**
+ * @brief Libère un plan FFT.
+ */
+void fft_f32_plan_free(FFTF32Plan *plan);
+
+/**
+ * @brief Exécute la FFT 2D en place avec un plan préparé (voir fft2d_f32_inplace).
+ *
+ * @return 0 en cas de succès, -1 si les dimensions ne correspondent pas au plan.
+ */
+int fft2d_f32_execute(const FFTF32Plan *plan, SplitComplexPlane *plane, int inverse);
+
+#endif // FFT_F32_H
@@ -0,0 +1,69 @@
+#ifndef FFT_TILED_H
+#define FFT_TILED_H
+
+#include "core/image.h"
+#include "fft/fft_f32.h"
+#include "fft/freq_filter.h"
+
+/**
+ * @struct FFTTilePlan
+ * @brief Plan de filtrage fréquentiel par blocs (overlap-save).
+ *
+ * Au lieu de transformer l'image entière (16 octets par pixel complété à une
+ * puissance de 2), l'image est découpée en blocs de tile_size x tile_size
+ * pixels. Chaque bloc est lu avec une marge (halo) de chaque côté, filtré
+ * dans le domaine fréquentiel, et seul son centre (core_size x core_size)
+ * est écrit dans l'image de sortie : le repliement circulaire de la FFT ne
+ * touche que la marge, qui est jetée.
+ *
+ * La mémoire de travail est bornée par la taille des blocs (deux matrices
+ * float de tile_size² par thread), indépendamment de la taille de l'image.
+ * Les blocs sont répartis sur le pool de threads.
+ *
+ * Le plan (FFT, filtre, buffers) se réutilise d'une image à l'autre.
+ * Les filtres idéaux ayant une réponse impulsionnelle infinie, le résultat
+ * approche celui du filtrage global d'autant mieux que le halo est grand.
+ */
+typedef struct {
+    int tile_size;              // Taille du bloc FFT (puissance de 2)
+    int halo;                   // Marge lue de chaque côté du bloc
+    int core_size;              // tile_size - 2 * halo : pixels produits par bloc
+    FreqFilter *filter;         // Filtre sur la grille du bloc (voir freq_filter_set_reference)
+    FFTF32Plan *fft_plan;
+    float *transfer;            // Copie float de H, mise à jour à chaque application
+    int num_buffers;            // Un buffer par thread
+    SplitComplexPlane **buffers;
+} FFTTilePlan;
+
+/**
+ * @brief Crée un plan de filtrage par blocs.
+ *
+ * Le filtre du plan (plan->filter) est vide : on y ajoute les opérations
+ * avec les fonctions freq_filter_add_*. Pour exprimer les rayons dans la
+ * grille du spectre de l'image entière, appeler freq_filter_set_reference()
+ * avec les dimensions retournées par fft_padded_size().
+ *
+ * @param tile_size Taille du bloc FFT (puissance de 2, au moins 16).
+ * @param halo Marge de chaque côté (0 <= halo < tile_size / 2).
+ * @return Le plan, ou NULL en cas d'erreur. À libérer avec fft_tile_plan_free().
+ */
+FFTTilePlan *fft_tile_plan_create(int tile_size, int halo);
+
+/**
+ * @brief Libère un plan de filtrage par blocs.
+ */
+void fft_tile_plan_free(FFTTilePlan *plan);
+
+/**
+ * @brief Filtre une image en niveaux de gris bloc par bloc.
+ *
+ * Les pixels du halo situés hors de l'image sont obtenus en répétant le bord.
+ * Le calcul se fait en simple précision (voir FFT_PRECISION_FLOAT).
+ *
+ * @param plan Le plan (son filtre doit être complet).
+ * @param src L'image source (1 canal).
+ * @return Une nouvelle image de même taille, ou NULL en cas d'erreur.
+ */
+Image *fft_tiled_filter(FFTTilePlan *plan, const Image *src);
+
+#endif // FFT_TILED_H
@@ -0,0 +1,153 @@
+#ifndef FREQ_FILTER_H
+#define FREQ_FILTER_H
+
+#include "fft/fft.h"
+
+/**
+ * @brief Type d'opération radiale (dépend uniquement de la distance au centre).
+ */
+typedef enum {
+    FREQ_OP_LOWPASS,   // H = 0 au-delà du rayon
+    FREQ_OP_HIGHPASS,  // H = 0 en deçà du rayon (inclus)
+    FREQ_OP_EMPHASIS   // H = k_low en deçà du rayon (inclus), k_high au-delà
+} FreqOpType;
+
+typedef struct {
+    FreqOpType type;
+    double radius_squared;
+    double k_low;
+    double k_high;
+} FreqRadialOp;
+
+/**
+ * @struct FreqFilter
+ * @brief Composition de filtres fréquentiels appliquée en une seule passe.
+ *
+ * On empile des opérations (passe-bas, passe-haut, rehaussement, notch),
+ * puis freq_filter_apply() construit la fonction de transfert H(u,v) et
+ * multiplie le spectre en un seul parcours. Les distances radiales sont
+ * tirées de tables précalculées dx²(u) et dy²(v) ; les notch ne visitent
+ * que la boîte englobante de leurs disques.
+ *
+ * H est gardée en cache : appliquer le même filtre à plusieurs spectres de
+ * même taille ne la reconstruit pas.
+ */
+typedef struct {
+    int width;               // Dimensions du spectre
+    int height;
+    FreqRadialOp *radial_ops;
+    int radial_count;
+    int radial_capacity;
+    NotchFilter *notches;    // (u,v) centrés ; le symétrique (-u,-v) est implicite
+    int notch_count;
+    int notch_capacity;
+    double scale_x;          // Pas de fréquence de H exprimé en pas de la grille de référence
+    double scale_y;          // (1 par défaut : les rayons sont en pas de H)
+    double *transfer;        // H(u,v), width * height, NULL tant que non construite
+    int transfer_valid;      // 0 si une opération a été ajoutée depuis la construction
+} FreqFilter;
+
+/**
+ * @brief Crée un filtre composite vide (H = 1) pour un spectre donné.
+ *
+ * @param width Largeur du spectre (issue de fft2d).
+ * @param height Hauteur du spectre.
+ * @return Le filtre, ou NULL en cas d'erreur. À libérer avec freq_filter_free().
+ */
+FreqFilter *freq_filter_create(int width, int height);
+
+/**
+ * @brief Exprime les rayons et positions des opérations dans une autre grille.
+ *
+ * Par défaut, un rayon r désigne r pas de fréquence du spectre width x height.
+ * Après cet appel, il désigne r pas d'un spectre de référence
+ * ref_width x ref_height : le même filtre s'applique ainsi à des blocs FFT
+ * plus petits que l'image entière (voir fft/fft_tiled.h).
+ *
+ * @return 0 en cas de succès, -1 si les dimensions sont invalides.
+ */
+int freq_filter_set_reference(FreqFilter *filter, int ref_width, int ref_height);
+
+/**
+ * @brief Libère un filtre composite.
+ */
+void freq_filter_free(FreqFilter *filter);
+
+/**
+ * @brief Ajoute un passe-bas idéal (équivalent à fft_lowpass_filter).
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int freq_filter_add_lowpass(FreqFilter *filter, int radius);
+
+/**
+ * @brief Ajoute un passe-haut idéal (équivalent à fft_highpass_filter).
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int freq_filter_add_highpass(FreqFilter *filter, int radius);
+
+/**
+ * @brief Ajoute un rehaussement fréquentiel (équivalent à fft_emphasis_filter).
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int freq_filter_add_emphasis(FreqFilter *filter, int radius, double k_low, double k_high);
+
+/**
+ * @brief Ajoute un notch en (u,v) et son symétrique (équivalent à fft_notch_filter).
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int freq_filter_add_notch(FreqFilter *filter, int u, int v, int radius);
+
+/**
+ * @brief Détecte les pics de bruit périodique et les ajoute comme notch.
+ *
+ * La détection porte sur le spectre déjà filtré par les opérations présentes
+ * dans le filtre (|H * F|), comme si elles avaient été appliquées avant.
+ * Le spectre lui-même n'est pas modifié.
+ *
+ * Étapes : médiane par quickselect (O(n), sans tri), maxima locaux 3x3
+ * au-dessus du seuil, puis regroupement du plus fort au plus faible : un pic
+ * à moins de 'radius' d'un pic retenu ou de son symétrique est absorbé.
+ * Au plus 32 paires sont retenues.
+ *
+ * @param filter Le filtre composite.
+ * @param fft_data Le spectre analysé.
+ * @param threshold_factor Facteur de seuil par rapport à la médiane (voir fft_auto_notch_filter).
+ * @param radius Rayon des notch ajoutés.
+ * @return Le nombre de paires de pics retenues, ou -1 en cas d'erreur.
+ */
+int freq_filter_add_auto_notches(FreqFilter *filter, Complex **fft_data, double threshold_factor, int radius);
+
+/**
+ * @brief Nombre total d'opérations du filtre.
+ */
+int freq_filter_op_count(const FreqFilter *filter);
+
+/**
+ * @brief Construit (si nécessaire) la fonction de transfert H(u,v).
+ *
+ * @return Un pointeur vers H (width * height, non décalée), ou NULL en cas d'erreur.
+ */
+const double *freq_filter_build(FreqFilter *filter);
+
+/**
+ * @brief Multiplie le spectre par H(u,v) en une seule passe.
+ *
+ * @param filter Le filtre composite (H est construite au premier appel).
+ * @param fft_data Le spectre (modifié en place), aux dimensions du filtre.
+ * @return 0 en cas de succès, -1 en cas d'erreur.
+ */
+int freq_filter_apply(FreqFilter *filter, Complex **fft_data);
+
+/**
+ * @brief Multiplie un spectre simple précision (SoA) par H(u,v).
+ *
+ * Chaque produit est calculé en double puis arrondi en float : le résultat
+ * est celui de freq_filter_apply sur le spectre recopié par fft2d_ex.
+ *
+ * @param filter Le filtre composite (H est construite au premier appel).
+ * @param plane Le spectre (modifié en place), aux dimensions du filtre.
+ * @return 0 en cas de succès, -1 en cas d'erreur.
+ */
+int freq_filter_apply_plane(FreqFilter *filter, SplitComplexPlane *plane);
+
+#endif // FREQ_FILTER_H
@@ -0,0 +1,33 @@
+#ifndef ADAPTIVE_THRESHOLD_H
+#define ADAPTIVE_THRESHOLD_H
+
+#include "core/image.h"
+
+/**
+ * @brief Méthode de calcul du seuil local.
+ */
+typedef enum {
+    ADAPTIVE_BRADLEY, // Bradley-Roth : objet si I < moyenne * (1 - k)
+    ADAPTIVE_SAUVOLA  // Sauvola : objet si I < moyenne * (1 + k * (écart-type / 128 - 1))
+} AdaptiveThresholdMethod;
+
+/**
+ * @brief Seuillage adaptatif : chaque pixel est comparé à un seuil calculé sur sa fenêtre.
+ *
+ * La moyenne (et l'écart-type pour Sauvola) de chaque fenêtre est tirée
+ * de tables de sommes cumulées (images intégrales) de l'image et de son
+ * carré, en sommes 64 bits : le coût par pixel est constant quelle que
+ * soit la taille de la fenêtre. Près des bords, la fenêtre est tronquée.
+ *
+ * Comme apply_threshold, les pixels sous le seuil passent à 0, les autres
+ * à 255. L'opération est faite en place.
+ *
+ * @param img L'image à modifier (niveaux de gris).
+ * @param method Bradley-Roth ou Sauvola.
+ * @param window Taille (impaire de préférence) de la fenêtre carrée.
+ * @param k Sensibilité (ex: 0.15 pour Bradley-Roth, 0.34 pour Sauvola).
+ * @return 0 en cas de succès, -1 en cas d'erreur.
+ */
+int apply_adaptive_threshold(Image *img, AdaptiveThresholdMethod method, int window, double k);
+
+#endif // ADAPTIVE_THRESHOLD_H
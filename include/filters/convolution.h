@@ -28,4 +28,76 @@ typedef struct {
  */
 Image *apply_convolution(const Image *src, const Kernel *kernel);
 
+/**
+ * @brief Méthode de calcul d'une convolution.
+ */
+typedef enum {
+    CONV_ENGINE_AUTO = 0,   // Choix par le modèle de coût (convolution_select_engine)
+    CONV_ENGINE_SPATIAL,    // Somme directe : K² opérations par pixel (apply_convolution)
+    CONV_ENGINE_SEPARABLE,  // Noyau de rang 1 : une passe horizontale puis une verticale, 2K par pixel
+    CONV_ENGINE_FFT         // Produit des spectres (FFT simple précision), O(log N) par pixel
+} ConvolutionEngine;
+
+/**
+ * @brief Indique si un noyau est séparable (produit d'une colonne par une ligne).
+ *
+ * @param kernel Le noyau.
+ * @param col Si non NULL et le noyau est séparable, reçoit le vecteur colonne (kernel->height valeurs).
+ * @param row Si non NULL et le noyau est séparable, reçoit le vecteur ligne (kernel->width valeurs).
+ * @return 1 si le noyau est séparable (à 1e-6 près, relativement au plus grand coefficient), 0 sinon.
+ */
+int kernel_is_separable(const Kernel *kernel, float *col, float *row);
+
+/**
+ * @brief Choisit la méthode la moins coûteuse pour une image et un noyau donnés.
+ *
+ * Le coût estimé par pixel est proportionnel à K_w * K_h en spatial, à
+ * K_w + K_h en séparable (si le noyau l'est), et à log2(N) * N / (largeur * hauteur)
+ * pour la FFT, N étant la taille de la matrice complétée à une puissance de 2.
+ * Les constantes ont été mesurées (voir convolution.c).
+ *
+ * @return CONV_ENGINE_SPATIAL, CONV_ENGINE_SEPARABLE ou CONV_ENGINE_FFT.
+ */
+ConvolutionEngine convolution_select_engine(const Image *src, const Kernel *kernel);
+
+/**
+ * @brief Nom lisible d'une méthode de convolution (pour les messages).
+ */
+const char *convolution_engine_name(ConvolutionEngine engine);
+
+/**
+ * @brief Applique une convolution avec la méthode demandée.
+ *
+ * Les trois méthodes calculent la même somme pondérée, avec la même gestion
+ * des bords (répétition du bord). CONV_ENGINE_SPATIAL est exactement
+ * apply_convolution (troncature directe de la somme). Les moteurs séparable
+ * et FFT ajoutent une marge de 1e-3 avant la troncature, l'ordre de leurs
+ * opérations flottantes pouvant placer une somme entière juste en dessous de
+ * l'entier : un pixel peut donc différer d'un niveau de gris de
+ * apply_convolution. Les filtres prédéfinis (flou moyenneur, gaussien...)
+ * utilisent toujours apply_convolution.
+ *
+ * @param src L'image source en niveaux de gris.
+ * @param kernel Le noyau de convolution.
+ * @param engine La méthode (CONV_ENGINE_AUTO pour laisser le modèle de coût choisir).
+ * @return Une nouvelle image, ou NULL en cas d'erreur.
+ */
+Image *apply_convolution_ex(const Image *src, const Kernel *kernel, ConvolutionEngine engine);
+
+/**
+ * @brief Charge un noyau depuis un fichier texte.
+ *
+ * Format : la largeur et la hauteur, puis largeur * hauteur coefficients,
+ * ligne par ligne, séparés par des espaces ou des retours à la ligne.
+ *
+ * @param path Chemin du fichier.
+ * @return Le noyau (à libérer avec free_kernel()), ou NULL en cas d'erreur.
+ */
+Kernel *load_kernel(const char *path);
+
+/**
+ * @brief Libère un noyau alloué par load_kernel().
+ */
+void free_kernel(Kernel *kernel);
+
 #endif // CONVOLUTION_H
\ No newline at end of file
@@ -39,6 +39,21 @@ void saturated_transform(Image *img, int min_in, int max_in);
  */
 void apply_threshold(Image *img, uint8_t threshold);
 
+/**
+ * @brief Quantifie une image en k + 1 niveaux à partir de k seuils croissants.
+ *
+ * Un pixel v appartient à la classe c = nombre de seuils inférieurs ou
+ * égaux à v et reçoit la valeur c * 255 / k. Comme dans apply_threshold,
+ * un pixel égal à un seuil passe dans la classe supérieure : avec k = 1,
+ * le résultat est celui d'apply_threshold. La correspondance est tabulée une fois (LUT de 256
+ * entrées), puis appliquée en une seule passe.
+ *
+ * @param img L'image à modifier (niveaux de gris, en place).
+ * @param thresholds Les k seuils, dans l'ordre croissant.
+ * @param num_thresholds Le nombre de seuils k (>= 1).
+ */
+void apply_multi_threshold(Image *img, const int *thresholds, int num_thresholds);
+
 /**
  * @brief Applique une correction gamma à l'image.
  * I' = 255 * (I / 255)^gamma
@@ -22,6 +22,20 @@ Image *apply_box_blur(const Image *src, int kernel_size);
  */
 Image *apply_gaussian_blur(const Image *src, int kernel_size);
 
+/**
+ * @brief Flou Gaussien récursif (Young - van Vliet), de coût indépendant de sigma.
+ *
+ * Chaque axe est filtré par un filtre IIR d'ordre 3, une passe causale puis
+ * une passe anti-causale : environ 14 opérations par pixel et par axe, que
+ * sigma vaille 1 ou 50. Les bords sont répétés. L'approximation est précise
+ * à quelques pourcents près de la gaussienne pour sigma >= 0.5.
+ *
+ * @param src L'image source (1 ou 3 canaux).
+ * @param sigma L'écart-type en pixels (une copie est retournée si sigma < 0.5).
+ * @return Une nouvelle image floutée, ou NULL en cas d'erreur.
+ */
+Image *apply_gaussian_blur_sigma(const Image *src, double sigma);
+
 /**
  * @brief Applique le filtre de Sobel pour la détection de contours.
  *
@@ -30,6 +44,34 @@ Image *apply_gaussian_blur(const Image *src, int kernel_size);
  */
 Image *apply_sobel_filter(const Image *src);
 
+/**
+ * @struct GradientField
+ * @brief Gradient signé d'une image (Gx, Gy), sans écrêtage.
+ *
+ * Contrairement à apply_sobel_filter, qui ne garde que la norme ramenée
+ * sur 0-255, les deux composantes sont conservées : l'orientation du
+ * gradient (atan2(gy, gx)) est la normale locale des contours.
+ */
+typedef struct {
+    int width;
+    int height;
+    float *gx;  // width * height
+    float *gy;
+} GradientField;
+
+/**
+ * @brief Calcule le gradient de Sobel (noyaux 3x3, bords répétés) en gardant Gx et Gy.
+ *
+ * @param src L'image source (1 canal).
+ * @return Le champ de gradient (à libérer avec free_gradient_field()), ou NULL en cas d'erreur.
+ */
+GradientField *compute_sobel_gradient(const Image *src);
+
+/**
+ * @brief Libère un champ de gradient.
+ */
+void free_gradient_field(GradientField *field);
+
 /**
  * @brief Applique un filtre de rehaussement de contours (netteté).
  *
@@ -0,0 +1,117 @@
+#ifndef PYRAMID_H
+#define PYRAMID_H
+
+#include "core/image.h"
+#include <stdint.h>
+
+/**
+ * @struct ImagePyramid
+ * @brief Suite d'images de résolution décroissante (niveau 0 = pleine résolution).
+ *
+ * Le niveau i + 1 mesure ceil(largeur / 2) x ceil(hauteur / 2) du niveau i.
+ */
+typedef struct {
+    int num_levels;
+    Image **levels;
+} ImagePyramid;
+
+/**
+ * @brief Réduit une image de moitié (REDUCE de Burt et Adelson).
+ *
+ * Lissage binomial 5x5 ([1 4 6 4 1] / 16 sur chaque axe) et
+ * sous-échantillonnage d'un pixel sur deux, en un seul passage : chaque
+ * ligne source est lissée horizontalement et décimée une seule fois dans
+ * un anneau de 5 lignes, puis combinée verticalement. Calcul entier exact,
+ * bords répliqués.
+ *
+ * @return L'image réduite, ou NULL en cas d'erreur.
+ */
+Image *pyramid_reduce(const Image *src);
+
+/**
+ * @brief Agrandit une image d'un facteur 2 (EXPAND), noyau binomial, vers width x height.
+ *
+ * @param src Image d'un niveau grossier.
+ * @param width Largeur cible (2 * largeur de src ou 2 * largeur - 1).
+ * @param height Hauteur cible.
+ * @return L'image agrandie, ou NULL en cas d'erreur.
+ */
+Image *pyramid_expand(const Image *src, int width, int height);
+
+/**
+ * @struct DetailImage
+ * @brief Niveau de détails d'une pyramide laplacienne, G(i) - EXPAND(G(i+1)), sur 16 bits signés.
+ */
+typedef struct {
+    int width;
+    int height;
+    int channels;
+    int16_t *data; // Valeurs dans [-255, 255], ligne par ligne
+} DetailImage;
+
+/**
+ * @struct LaplacianPyramid
+ * @brief Pyramide laplacienne sans perte : détails signés et niveau gaussien le plus grossier.
+ */
+typedef struct {
+    int num_levels;        // Niveaux de détails + résidu
+    DetailImage **details; // num_levels - 1 niveaux, du plus fin au plus grossier
+    Image *residual;       // Dernier niveau gaussien
+} LaplacianPyramid;
+
+/**
+ * @brief Construit les pyramides gaussienne et laplacienne en un seul passage.
+ *
+ * Chaque niveau gaussien n'est calculé qu'une fois : dès que G(i+1) est
+ * disponible, le niveau de détails G(i) - EXPAND(G(i+1)) est produit.
+ *
+ * @param src Image source (1 ou 3 canaux).
+ * @param num_levels Nombre de niveaux souhaité ; la construction s'arrête à 1x1.
+ * @param gaussian Reçoit la pyramide gaussienne (niveau 0 = copie de src), ou NULL si inutile.
+ * @param laplacian Reçoit la pyramide laplacienne, ou NULL si inutile.
+ * @return 0 en cas de succès, -1 en cas d'erreur (rien n'est alloué).
+ */
+int build_pyramids(const Image *src, int num_levels, ImagePyramid **gaussian, LaplacianPyramid **laplacian);
+
+/**
+ * @brief Construit une pyramide gaussienne (voir build_pyramids).
+ * @return La pyramide, ou NULL en cas d'erreur. À libérer avec free_pyramid().
+ */
+ImagePyramid *build_gaussian_pyramid(const Image *src, int num_levels);
+
+/**
+ * @brief Construit une pyramide laplacienne (voir build_pyramids).
+ * @return La pyramide, ou NULL en cas d'erreur. À libérer avec free_laplacian_pyramid().
+ */
+LaplacianPyramid *build_laplacian_pyramid(const Image *src, int num_levels);
+
+/**
+ * @brief Reconstruit l'image source : G(i) = EXPAND(G(i+1)) + détails(i), du résidu vers le niveau 0.
+ *
+ * Les détails étant stockés sans perte, la reconstruction est exacte.
+ *
+ * @return L'image reconstruite, ou NULL en cas d'erreur.
+ */
+Image *pyramid_collapse(const LaplacianPyramid *pyramid);
+
+/**
+ * @brief Convertit un niveau laplacien en image affichable.
+ *
+ * Les détails sont centrés sur 128 et bornés à [0, 255] (conversion avec
+ * perte, pour visualisation seulement) ; le dernier niveau est le résidu.
+ *
+ * @return L'image, ou NULL en cas d'erreur.
+ */
+Image *laplacian_level_to_image(const LaplacianPyramid *pyramid, int level);
+
+/**
+ * @brief Libère une pyramide laplacienne.
+ */
+void free_laplacian_pyramid(LaplacianPyramid *pyramid);
+
+/**
+ * @brief Libère une pyramide et ses niveaux.
+ */
+void free_pyramid(ImagePyramid *pyramid);
+
+#endif // PYRAMID_H
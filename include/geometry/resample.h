@@ -0,0 +1,38 @@
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#include "core/image.h"
+
+/**
+ * @brief Noyau d'interpolation pour resize_resample.
+ */
+typedef enum {
+    RESAMPLE_BICUBIC,  // Cubique de Keys (a = -0.5), support 2
+    RESAMPLE_LANCZOS3  // sinc(x) sinc(x/3), support 3
+} ResampleFilter;
+
+/**
+ * @brief Redimensionne une image avec un noyau bicubique ou Lanczos-3.
+ *
+ * Deux passes séparables (horizontale puis verticale) en flottants. Les
+ * tables de poids de chaque axe (indices sources bornés et poids normalisés,
+ * noyau élargi en réduction pour éviter le crénelage) sont calculées une
+ * fois par triplet (taille source, taille cible, noyau) et gardées en cache :
+ * redimensionner une suite d'images de même taille ne les recalcule pas.
+ * L'accumulation verticale est vectorisée (SSE2/AVX2), avec les mêmes
+ * opérations dans le même ordre que le code scalaire.
+ *
+ * @param src Image source (1 ou 3 canaux).
+ * @param new_width Nouvelle largeur.
+ * @param new_height Nouvelle hauteur.
+ * @param filter Noyau utilisé.
+ * @return Nouvelle image redimensionnée, ou NULL en cas d'erreur.
+ */
+Image *resize_resample(const Image *src, int new_width, int new_height, ResampleFilter filter);
+
+/**
+ * @brief Vide le cache des tables de poids (les tables en cours d'utilisation sont conservées).
+ */
+void resample_cache_clear(void);
+
+#endif // RESAMPLE_H
@@ -16,15 +16,78 @@ Image *resize_nearest_neighbor(const Image *src, int new_width, int new_height);
 /**
  * @brief Redimensionne une image avec interpolation bilinéaire.
  * Donne un résultat plus lisse que le plus proche voisin.
+ *
+ * Moteur séparable en virgule fixe : indices et poids (Q8) tabulés une fois
+ * par colonne et par ligne, interpolation horizontale de chaque ligne source
+ * dans un anneau de deux lignes, puis verticale (SSE2/AVX2), en parallèle
+ * sur les lignes de sortie. Résultat arrondi au plus proche.
  */
 Image *resize_bilinear(const Image *src, int new_width, int new_height);
 
+/**
+ * @brief Réduit une image par moyenne de surface (filtre boîte).
+ *
+ * Chaque pixel de sortie est la moyenne pondérée de tous les pixels sources
+ * qu'il recouvre : pas de crénelage sur les fortes réductions. Chemins
+ * rapides en arithmétique entière pour les facteurs entiers (2x, 4x...).
+ * Si l'une des dimensions augmente, l'appel est délégué à resize_bilinear.
+ *
+ * @param src Image source.
+ * @param new_width Nouvelle largeur (<= largeur source).
+ * @param new_height Nouvelle hauteur (<= hauteur source).
+ * @return Nouvelle image réduite, ou NULL en cas d'erreur.
+ */
+Image *resize_area(const Image *src, int new_width, int new_height);
+
 /**
  * @brief Applique une rotation à l'image autour de son centre.
+ * Équivaut à rotate_image_ex(src, angle_deg, ROTATE_NEAREST, 0).
  * @param src Image source.
  * @param angle_deg Angle en degrés (sens horaire).
  * @return Nouvelle image tournée (dimensions identiques, bords noirs).
  */
 Image *rotate_image(const Image *src, double angle_deg);
 
+/**
+ * @brief Échantillonnage utilisé par rotate_image_ex.
+ */
+typedef enum {
+    ROTATE_NEAREST,  // Plus proche voisin
+    ROTATE_BILINEAR  // Bilinéaire (poids sur 8 bits), bords fondus vers le noir
+} RotateInterpolation;
+
+/**
+ * @brief Rotation autour du centre de l'image, avec choix de l'échantillonnage et du cadre.
+ *
+ * La position source est calculée une fois par ligne puis avancée d'un pas
+ * constant en virgule fixe 32.32 (DDA) : aucune multiplication par pixel.
+ * Les angles multiples de 90° (à 1e-9 près) sont traités exactement par une
+ * transposition en blocs (sauf 90°/270° sur une image non carrée sans
+ * agrandissement du cadre, qui passent par le cas général).
+ *
+ * @param src Image source.
+ * @param angle_deg Angle en degrés (sens horaire).
+ * @param interp Plus proche voisin ou bilinéaire.
+ * @param expand 0 : mêmes dimensions que la source (coins coupés) ;
+ *               1 : cadre agrandi pour contenir toute l'image tournée.
+ * @return Nouvelle image tournée (bords noirs), ou NULL en cas d'erreur.
+ */
+Image *rotate_image_ex(const Image *src, double angle_deg, RotateInterpolation interp, int expand);
+
+/**
+ * @brief Rotation par trois cisaillements successifs (Paeth) : horizontal, vertical, horizontal.
+ *
+ * Chaque passe décale des lignes (ou des colonnes, traitées par bandes de
+ * 1024) entières avec interpolation linéaire : les accès mémoire restent
+ * séquentiels, contrairement à la lecture en diagonale de rotate_image_ex,
+ * ce qui paie sur les très grandes images. Au-delà de 45°, un nombre exact
+ * de quarts de tour est appliqué d'abord. Les bords sont fondus vers le noir.
+ *
+ * @param src Image source.
+ * @param angle_deg Angle en degrés (sens horaire).
+ * @param expand 0 : mêmes dimensions que la source ; 1 : cadre agrandi (voir rotate_image_ex).
+ * @return Nouvelle image tournée, ou NULL en cas d'erreur.
+ */
+Image *rotate_image_shear(const Image *src, double angle_deg, int expand);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+#ifndef WARP_H
+#define WARP_H
+
+#include "core/image.h"
+
+/**
+ * @brief Échantillonnage utilisé par les déformations.
+ */
+typedef enum {
+    WARP_NEAREST,  // Plus proche voisin
+    WARP_BILINEAR  // Bilinéaire (poids sur 8 bits), bords fondus vers le noir
+} WarpInterpolation;
+
+/**
+ * @brief Déformation affine (matrice directe 2x3, de la source vers la destination).
+ *
+ * Chaque pixel (x, y) de la destination lit la source au point
+ * M^-1 (x, y) : la matrice est inversée une fois. La sortie est parcourue
+ * par tuiles de 64 x 64 pixels (les pixels sources lus par une tuile
+ * restent en cache), traitées en parallèle par bandes. Le long
+ * d'une ligne de tuile, la position source avance d'un pas constant en
+ * virgule fixe 32.32 : le calcul est exact, sans multiplication par pixel.
+ *
+ * @param src Image source (niveaux de gris ou RVB).
+ * @param matrix {a, b, c, d, e, f} : x' = a x + b y + c, y' = d x + e y + f.
+ * @param out_width Largeur de la destination.
+ * @param out_height Hauteur de la destination.
+ * @param interp Plus proche voisin ou bilinéaire.
+ * @return Nouvelle image (pixels hors de la source en noir), ou NULL si la
+ *         matrice n'est pas inversible ou en cas d'erreur.
+ */
+Image *warp_affine(const Image *src, const double matrix[6], int out_width, int out_height,
+                   WarpInterpolation interp);
+
+/**
+ * @brief Déformation perspective (homographie directe 3x3, ligne par ligne).
+ *
+ * Même parcours par tuiles que warp_affine. Les coordonnées homogènes
+ * avancent par additions le long d'une ligne ; la division perspective
+ * se fait par une seule réciproque partagée par x et y, calculée une fois
+ * par ligne lorsque le dénominateur ne dépend pas de x (matrix[6] == 0),
+ * une fois par pixel sinon. Les points derrière la caméra sont noirs.
+ *
+ * @param matrix {h0..h8} : x' = (h0 x + h1 y + h2) / (h6 x + h7 y + h8), etc.
+ * @return Nouvelle image, ou NULL si la matrice n'est pas inversible ou en cas d'erreur.
+ */
+Image *warp_perspective(const Image *src, const double matrix[9], int out_width, int out_height,
+                        WarpInterpolation interp);
+
+/**
+ * @brief Table de correspondance précalculée (position source de chaque pixel de sortie).
+ *
+ * Pour appliquer la même déformation à une suite d'images de même taille
+ * (rectification d'un flux caméra), les coordonnées ne sont calculées
+ * qu'une fois ; chaque image ne coûte plus que l'échantillonnage.
+ * La table occupe 10 octets par pixel de sortie et convient aux deux
+ * interpolations. Elle peut être utilisée simultanément par plusieurs threads.
+ */
+typedef struct WarpMap WarpMap;
+
+/**
+ * @brief Précalcule la table d'une déformation affine (voir warp_affine).
+ * @param src_width Largeur des images sources auxquelles la table s'appliquera.
+ * @param src_height Hauteur des images sources.
+ * @return La table, ou NULL en cas d'erreur. À libérer avec warp_map_free().
+ */
+WarpMap *warp_map_create_affine(const double matrix[6], int src_width, int src_height,
+                                int out_width, int out_height);
+
+/**
+ * @brief Précalcule la table d'une déformation perspective (voir warp_perspective).
+ * @return La table, ou NULL en cas d'erreur. À libérer avec warp_map_free().
+ */
+WarpMap *warp_map_create_perspective(const double matrix[9], int src_width, int src_height,
+                                     int out_width, int out_height);
+
+/**
+ * @brief Libère une table de correspondance.
+ */
+void warp_map_free(WarpMap *map);
+
+/**
+ * @brief Applique une table précalculée à une image.
+ *
+ * Le résultat est identique à celui de warp_affine / warp_perspective.
+ *
+ * @param src Image source, aux dimensions données à la création de la table.
+ * @return Nouvelle image, ou NULL si les dimensions ne correspondent pas ou en cas d'erreur.
+ */
+Image *warp_map_apply(const Image *src, const WarpMap *map, WarpInterpolation interp);
+
+#endif // WARP_H
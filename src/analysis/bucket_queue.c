@@ -0,0 +1,66 @@
+#include "analysis/bucket_queue.h"
+#include <stdlib.h>
+#include <string.h>
+
+BucketQueue *bucket_queue_create(int num_levels) {
+    if (num_levels <= 0) return NULL;
+    BucketQueue *queue = malloc(sizeof(BucketQueue));
+    if (!queue) return NULL;
+    queue->levels = calloc(num_levels, sizeof(BucketQueueLevel));
+    if (!queue->levels) {
+        free(queue);
+        return NULL;
+    }
+    queue->num_levels = num_levels;
+    queue->current = num_levels;
+    queue->size = 0;
+    return queue;
+}
+
+void bucket_queue_free(BucketQueue *queue) {
+    if (!queue) return;
+    for (int i = 0; i < queue->num_levels; i++) free(queue->levels[i].items);
+    free(queue->levels);
+    free(queue);
+}
+
+int bucket_queue_push(BucketQueue *queue, int level, int value) {
+    if (level < 0) level = 0;
+    if (level >= queue->num_levels) level = queue->num_levels - 1;
+    BucketQueueLevel *b = &queue->levels[level];
+
+    if (b->count == b->capacity) {
+        if (b->head > 0) {
+            // Récupérer la place des éléments déjà extraits avant d'agrandir
+            memmove(b->items, b->items + b->head, (b->count - b->head) * sizeof(int));
+            b->count -= b->head;
+            b->head = 0;
+        }
+        if (b->count == b->capacity) {
+            int capacity = b->capacity ? b->capacity * 2 : 64;
+            int *grown = realloc(b->items, capacity * sizeof(int));
+            if (!grown) return -1;
+            b->items = grown;
+            b->capacity = capacity;
+        }
+    }
+    b->items[b->count++] = value;
+    queue->size++;
+    if (level < queue->current) queue->current = level;
+    return 0;
+}
+
+int bucket_queue_pop(BucketQueue *queue, int *value) {
+    if (queue->size == 0) return -1;
+    while (queue->levels[queue->current].head == queue->levels[queue->current].count) {
+        queue->current++;
+    }
+    BucketQueueLevel *b = &queue->levels[queue->current];
+    *value = b->items[b->head++];
+    if (b->head == b->count) {
+        b->head = 0;
+        b->count = 0;
+    }
+    queue->size--;
+    return queue->current;
+}
@@ -132,4 +132,66 @@ int calculate_otsu_threshold(const Image *img) {
     
     printf("Seuil optimal d'Otsu calculé : %d\n", threshold);
     return threshold;
-}
\ No newline at end of file
+}
+// Terme d'une classe [a, b] : S1² / S0 (la variance inter-classes est, à une
+// constante près, la somme de ces termes)
+static double _class_term(const double *p0, const double *p1, int a, int b) {
+    double w = p0[b + 1] - p0[a];
+    if (w <= 0) return 0.0;
+    double s = p1[b + 1] - p1[a];
+    return s * s / w;
+}
+
+int calculate_multi_otsu_thresholds(const Image *img, int num_thresholds, int *thresholds) {
+    if (!img || !img->data || img->channels != 1 || !thresholds ||
+        num_thresholds < 1 || num_thresholds > MULTI_OTSU_MAX_THRESHOLDS) {
+        fprintf(stderr, "calculate_multi_otsu_thresholds: Arguments invalides (1 à %d seuils).\n",
+                MULTI_OTSU_MAX_THRESHOLDS);
+        return -1;
+    }
+
+    int hist[256];
+    calculate_histogram(img, hist);
+
+    // Sommes cumulées : p0[i] = effectif des niveaux < i, p1[i] = somme de leurs valeurs
+    double p0[257], p1[257];
+    p0[0] = p1[0] = 0.0;
+    for (int i = 0; i < 256; i++) {
+        p0[i + 1] = p0[i] + hist[i];
+        p1[i + 1] = p1[i] + (double)i * hist[i];
+    }
+
+    // best[j][e] : meilleur score pour découper [0, e] en j + 1 classes
+    // from[j][e] : dernier niveau de la classe j - 1 pour ce score
+    double best[MULTI_OTSU_MAX_THRESHOLDS + 1][256];
+    int from[MULTI_OTSU_MAX_THRESHOLDS + 1][256];
+    for (int e = 0; e < 256; e++) best[0][e] = _class_term(p0, p1, 0, e);
+
+    for (int j = 1; j <= num_thresholds; j++) {
+        for (int e = j; e < 256; e++) {
+            double best_score = -1.0;
+            int best_s = j - 1;
+            for (int s = j - 1; s < e; s++) {
+                double score = best[j - 1][s] + _class_term(p0, p1, s + 1, e);
+                if (score > best_score) {
+                    best_score = score;
+                    best_s = s;
+                }
+            }
+            best[j][e] = best_score;
+            from[j][e] = best_s;
+        }
+    }
+
+    // Remonter les choix depuis la dernière classe
+    int e = 255;
+    for (int j = num_thresholds; j >= 1; j--) {
+        e = from[j][e];
+        thresholds[j - 1] = e;
+    }
+
+    printf("Seuils d'Otsu multi-niveaux calculés :");
+    for (int j = 0; j < num_thresholds; j++) printf(" %d", thresholds[j]);
+    printf("\n");
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "analysis/hough.h"
+#include "core/parallel.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
@@ -40,81 +41,788 @@ void draw_line_polar(Image *img, double rho, double theta_rad) {
     }
 }
 
-Image *hough_transform(const Image *edge_img, Image **accumulator_view, int threshold) {
-    if (!edge_img) return NULL;
+// --- Vote : liste de points, tables trigonométriques, accumulateur par theta ---
+
+// Virgule fixe Q16.16 pour le vote entier
+#define HOUGH_FIXED_SHIFT 16
+#define HOUGH_FIXED_ONE (1 << HOUGH_FIXED_SHIFT)
+
+// Mémoire totale tolérée pour les accumulateurs privés (un par thread)
+#define HOUGH_PRIVATE_ACC_BUDGET (4 * 1024 * 1024)
+
+void hough_default_options(HoughOptions *opts) {
+    opts->theta_dim = 180;
+    opts->use_fixed_point = 0;
+    opts->parallel_mode = HOUGH_PARALLEL_AUTO;
+    opts->gradient = NULL;
+    opts->gradient_tolerance = 10.0;
+}
 
+int hough_collect_edge_points(const Image *edge_img, HoughPoint **out_points) {
+    if (!edge_img || !edge_img->data || !out_points) return -1;
     int w = edge_img->width;
     int h = edge_img->height;
-    
-    // 1. Définir l'espace paramétrique
-    // Diagonale max pour rho
-    double hough_h = sqrt(w * w + h * h);
-    int rho_dim = (int)(hough_h * 2); // De -rho à +rho
-    int theta_dim = 180; // 0 à 180 degrés
 
-    // Allocation de l'accumulateur (int)
-    int *acc = (int *)calloc(rho_dim * theta_dim, sizeof(int));
-    if (!acc) return NULL;
+    // Premier passage : compter, pour allouer juste ce qu'il faut
+    int count = 0;
+    for (int i = 0; i < w * h; i++) {
+        if (edge_img->data[i] > 0) count++;
+    }
 
-    // 2. Vote (Remplissage de l'accumulateur)
-    // Pour chaque pixel blanc de l'image de contours
+    HoughPoint *points = malloc((count > 0 ? count : 1) * sizeof(HoughPoint));
+    if (!points) return -1;
+    int n = 0;
     for (int y = 0; y < h; y++) {
+        const uint8_t *row = edge_img->data + (size_t)y * w;
         for (int x = 0; x < w; x++) {
-            if (edge_img->data[y * w + x] > 0) { // Si c'est un bord
-                
-                for (int t = 0; t < theta_dim; t++) {
-                    double theta_rad = t * M_PI / 180.0;
-                    double rho = x * cos(theta_rad) + y * sin(theta_rad);
-                    
-                    // Conversion rho réel -> index tableau
-                    int rho_idx = (int)(rho + hough_h); // Décalage pour index positif
-                    
-                    if (rho_idx >= 0 && rho_idx < rho_dim) {
-                        acc[rho_idx * theta_dim + t]++;
-                    }
+            if (row[x] > 0) {
+                points[n].x = x;
+                points[n].y = y;
+                n++;
+            }
+        }
+    }
+    *out_points = points;
+    return count;
+}
+
+HoughTrigTable *hough_trig_table_create(int theta_dim) {
+    if (theta_dim <= 0) return NULL;
+    HoughTrigTable *table = malloc(sizeof(HoughTrigTable));
+    if (!table) return NULL;
+    table->theta_dim = theta_dim;
+    table->cos_t = malloc(theta_dim * sizeof(double));
+    table->sin_t = malloc(theta_dim * sizeof(double));
+    table->cos_fx = malloc(theta_dim * sizeof(int32_t));
+    table->sin_fx = malloc(theta_dim * sizeof(int32_t));
+    if (!table->cos_t || !table->sin_t || !table->cos_fx || !table->sin_fx) {
+        hough_trig_table_free(table);
+        return NULL;
+    }
+    for (int t = 0; t < theta_dim; t++) {
+        // Même expression que le vote historique (t * PI / 180 pour 180 angles)
+        double theta_rad = t * M_PI / theta_dim;
+        table->cos_t[t] = cos(theta_rad);
+        table->sin_t[t] = sin(theta_rad);
+        table->cos_fx[t] = (int32_t)lround(table->cos_t[t] * HOUGH_FIXED_ONE);
+        table->sin_fx[t] = (int32_t)lround(table->sin_t[t] * HOUGH_FIXED_ONE);
+    }
+    return table;
+}
+
+void hough_trig_table_free(HoughTrigTable *table) {
+    if (table) {
+        free(table->cos_t);
+        free(table->sin_t);
+        free(table->cos_fx);
+        free(table->sin_fx);
+        free(table);
+    }
+}
+
+void hough_accumulator_free(HoughAccumulator *acc) {
+    if (acc) {
+        free(acc->votes);
+        free(acc);
+    }
+}
+
+// Votes des points [begin, end) pour les angles [t0, t1), en double.
+// Pour chaque angle, la colonne est écrite pendant que cos/sin restent en registre.
+static void _vote_double(const HoughPoint *points, int begin, int end, const HoughTrigTable *trig,
+                         int t0, int t1, int *votes, int rho_dim, double rho_offset) {
+    for (int t = t0; t < t1; t++) {
+        double c = trig->cos_t[t];
+        double s = trig->sin_t[t];
+        int *column = votes + (size_t)t * rho_dim;
+        for (int i = begin; i < end; i++) {
+            double rho = points[i].x * c + points[i].y * s;
+            int rho_idx = (int)(rho + rho_offset); // Décalage pour index positif
+            if (rho_idx >= 0 && rho_idx < rho_dim) {
+                column[rho_idx]++;
+            }
+        }
+    }
+}
+
+// Même vote en virgule fixe : rho_idx = floor((x cos + y sin + offset) * 2^16) >> 16
+static void _vote_fixed(const HoughPoint *points, int begin, int end, const HoughTrigTable *trig,
+                        int t0, int t1, int *votes, int rho_dim, double rho_offset) {
+    int64_t offset_fx = (int64_t)llround(rho_offset * HOUGH_FIXED_ONE);
+    for (int t = t0; t < t1; t++) {
+        int64_t c = trig->cos_fx[t];
+        int64_t s = trig->sin_fx[t];
+        int *column = votes + (size_t)t * rho_dim;
+        for (int i = begin; i < end; i++) {
+            int64_t rho_fx = points[i].x * c + points[i].y * s + offset_fx;
+            if (rho_fx < 0) continue;
+            int64_t rho_idx = rho_fx >> HOUGH_FIXED_SHIFT;
+            if (rho_idx < rho_dim) {
+                column[rho_idx]++;
+            }
+        }
+    }
+}
+
+// Vote contraint : le point i ne vote que pour les angles de sa fenêtre
+// [center[i] - half_window, center[i] + half_window] (modulo theta_dim),
+// restreinte à [t0, t1). Un angle replié de l'autre côté de 180° correspond
+// à la même droite avec rho opposé : le rho calculé pour l'angle replié est juste.
+// La fenêtre (au plus theta_dim angles) est intersectée avec [t0, t1) décalé
+// de -theta_dim, 0 et +theta_dim : seuls les angles retenus sont parcourus.
+static void _vote_oriented(const HoughPoint *points, const int *center, int half_window,
+                           int begin, int end, const HoughTrigTable *trig, int t0, int t1,
+                           int use_fixed_point, int *votes, int rho_dim, double rho_offset) {
+    int theta_dim = trig->theta_dim;
+    int64_t offset_fx = (int64_t)llround(rho_offset * HOUGH_FIXED_ONE);
+    for (int i = begin; i < end; i++) {
+        if (center[i] < 0) continue; // Gradient nul
+        int x = points[i].x;
+        int y = points[i].y;
+        for (int shift = -theta_dim; shift <= theta_dim; shift += theta_dim) {
+            int u0 = center[i] - half_window > t0 + shift ? center[i] - half_window : t0 + shift;
+            int u1 = center[i] + half_window < t1 - 1 + shift ? center[i] + half_window : t1 - 1 + shift;
+            for (int t = u0 - shift; t <= u1 - shift; t++) {
+                int rho_idx;
+                if (use_fixed_point) {
+                    int64_t rho_fx = x * (int64_t)trig->cos_fx[t] + y * (int64_t)trig->sin_fx[t] + offset_fx;
+                    if (rho_fx < 0) continue;
+                    rho_idx = (int)(rho_fx >> HOUGH_FIXED_SHIFT);
+                } else {
+                    rho_idx = (int)(x * trig->cos_t[t] + y * trig->sin_t[t] + rho_offset);
+                }
+                if (rho_idx >= 0 && rho_idx < rho_dim) {
+                    votes[(size_t)t * rho_dim + rho_idx]++;
                 }
             }
         }
     }
+}
 
-    // 3. (Optionnel) Créer l'image de visualisation de l'accumulateur (Hough Space)
-    if (accumulator_view) {
-        *accumulator_view = createImage(theta_dim, rho_dim, 1);
-        int max_vote = 0;
-        for (int i = 0; i < rho_dim * theta_dim; i++) {
-            if (acc[i] > max_vote) max_vote = acc[i];
+// Angle (en cases) de la normale de chaque point, d'après le gradient ; -1 si nul
+static int *_gradient_theta_bins(const HoughPoint *points, int count, const GradientField *g, int theta_dim) {
+    int *center = malloc((count > 0 ? count : 1) * sizeof(int));
+    if (!center) return NULL;
+    for (int i = 0; i < count; i++) {
+        size_t idx = (size_t)points[i].y * g->width + points[i].x;
+        float gx = g->gx[idx];
+        float gy = g->gy[idx];
+        if (gx == 0.0f && gy == 0.0f) {
+            center[i] = -1;
+            continue;
         }
-        
-        // Normalisation pour affichage
-        for (int i = 0; i < rho_dim * theta_dim; i++) {
-            if (max_vote > 0)
-                (*accumulator_view)->data[i] = (uint8_t)((acc[i] * 255) / max_vote);
+        double angle = atan2(gy, gx); // ]-PI, PI]
+        if (angle < 0) angle += M_PI; // Même droite, rho opposé
+        int t = (int)lround(angle * theta_dim / M_PI);
+        center[i] = t % theta_dim;
+    }
+    return center;
+}
+
+// --- Vote parallèle ---
+
+typedef struct {
+    const HoughPoint *points;
+    int count;
+    const HoughTrigTable *trig;
+    int use_fixed_point;
+    int rho_dim;
+    int theta_dim;
+    double rho_offset;
+    int *votes;          // Accumulateur final
+    int **private_votes; // Accumulateurs privés (découpage par points), [0] = votes
+    const int *center;   // Vote contraint : angle central de chaque point (NULL sinon)
+    int half_window;
+    // Vote contraint découpé par angles : points regroupés par angle central
+    const HoughPoint *bucket_points;
+    const int *bucket_center;
+    const int *bucket_start; // theta_dim + 1 bornes, le groupe c est [start[c], start[c + 1])
+} HoughVoteContext;
+
+static void _vote_range(const HoughVoteContext *ctx, int begin, int end, int t0, int t1, int *votes) {
+    if (ctx->center) {
+        _vote_oriented(ctx->points, ctx->center, ctx->half_window, begin, end, ctx->trig, t0, t1,
+                       ctx->use_fixed_point, votes, ctx->rho_dim, ctx->rho_offset);
+    } else if (ctx->use_fixed_point) {
+        _vote_fixed(ctx->points, begin, end, ctx->trig, t0, t1, votes, ctx->rho_dim, ctx->rho_offset);
+    } else {
+        _vote_double(ctx->points, begin, end, ctx->trig, t0, t1, votes, ctx->rho_dim, ctx->rho_offset);
+    }
+}
+
+// begin/end : indices de points ; chaque thread vote dans sa propre copie
+static void _points_worker(void *arg, int begin, int end, int thread_id) {
+    HoughVoteContext *ctx = (HoughVoteContext *)arg;
+    _vote_range(ctx, begin, end, 0, ctx->theta_dim, ctx->private_votes[thread_id]);
+}
+
+// Regroupe les points par angle central (tri par comptage, gradient nul écarté),
+// pour que le découpage par angles ne parcoure que les points concernés
+static int _bucket_by_center(HoughVoteContext *ctx, HoughPoint **points_out, int **center_out, int **start_out) {
+    int theta_dim = ctx->theta_dim;
+    int count = ctx->count;
+    HoughPoint *points = malloc((count > 0 ? count : 1) * sizeof(HoughPoint));
+    int *center = malloc((count > 0 ? count : 1) * sizeof(int));
+    int *start = calloc(theta_dim + 1, sizeof(int));
+    int *next = malloc(theta_dim * sizeof(int));
+    if (!points || !center || !start || !next) {
+        free(points);
+        free(center);
+        free(start);
+        free(next);
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (ctx->center[i] >= 0) start[ctx->center[i] + 1]++;
+    }
+    for (int c = 0; c < theta_dim; c++) {
+        start[c + 1] += start[c];
+        next[c] = start[c];
+    }
+    for (int i = 0; i < count; i++) {
+        int c = ctx->center[i];
+        if (c < 0) continue;
+        points[next[c]] = ctx->points[i];
+        center[next[c]++] = c;
+    }
+    free(next);
+    *points_out = points;
+    *center_out = center;
+    *start_out = start;
+    return 0;
+}
+
+// begin/end : indices d'angles ; les colonnes sont disjointes entre threads
+static void _theta_worker(void *arg, int begin, int end, int thread_id) {
+    HoughVoteContext *ctx = (HoughVoteContext *)arg;
+    (void)thread_id;
+    if (!ctx->bucket_start) {
+        _vote_range(ctx, 0, ctx->count, begin, end, ctx->votes);
+        return;
+    }
+
+    // Seuls les angles centraux de [begin - fenêtre, end + fenêtre) touchent les
+    // colonnes [begin, end) : au plus deux plages de groupes, à cause du repli.
+    int theta_dim = ctx->theta_dim;
+    int lo = begin - ctx->half_window;
+    int hi = end + ctx->half_window;
+    int ranges[2][2] = {{lo, hi}, {0, 0}};
+    if (hi - lo >= theta_dim) {
+        ranges[0][0] = 0;
+        ranges[0][1] = theta_dim;
+    } else if (lo < 0) {
+        ranges[0][0] = 0;
+        ranges[1][0] = lo + theta_dim;
+        ranges[1][1] = theta_dim;
+    } else if (hi > theta_dim) {
+        ranges[0][1] = theta_dim;
+        ranges[1][1] = hi - theta_dim;
+    }
+    for (int k = 0; k < 2; k++) {
+        if (ranges[k][0] >= ranges[k][1]) continue;
+        _vote_oriented(ctx->bucket_points, ctx->bucket_center, ctx->half_window,
+                       ctx->bucket_start[ranges[k][0]], ctx->bucket_start[ranges[k][1]], ctx->trig,
+                       begin, end, ctx->use_fixed_point, ctx->votes, ctx->rho_dim, ctx->rho_offset);
+    }
+}
+
+// Somme des accumulateurs privés dans le premier, découpée par cases
+static void _reduce_worker(void *arg, int begin, int end, int thread_id) {
+    HoughVoteContext *ctx = (HoughVoteContext *)arg;
+    (void)thread_id;
+    size_t total = (size_t)ctx->rho_dim * ctx->theta_dim;
+    size_t i0 = total * begin / ctx->theta_dim;
+    size_t i1 = total * end / ctx->theta_dim;
+    int k = 1;
+    while (ctx->private_votes[k]) {
+        const int *src = ctx->private_votes[k++];
+        for (size_t i = i0; i < i1; i++) ctx->votes[i] += src[i];
+    }
+}
+
+HoughAccumulator *hough_accumulate(const Image *edge_img, const HoughOptions *opts) {
+    if (!edge_img || !edge_img->data) return NULL;
+    HoughOptions defaults;
+    if (!opts) {
+        hough_default_options(&defaults);
+        opts = &defaults;
+    }
+
+    int w = edge_img->width;
+    int h = edge_img->height;
+
+    // 1. Espace paramétrique : rho sur [-diagonale, +diagonale]
+    double hough_h = sqrt(w * w + h * h);
+    HoughAccumulator *acc = malloc(sizeof(HoughAccumulator));
+    if (!acc) return NULL;
+    acc->rho_dim = (int)(hough_h * 2);
+    acc->theta_dim = opts->theta_dim;
+    acc->rho_offset = hough_h;
+    acc->votes = calloc((size_t)acc->rho_dim * acc->theta_dim, sizeof(int));
+
+    HoughPoint *points = NULL;
+    int count = hough_collect_edge_points(edge_img, &points);
+    HoughTrigTable *trig = hough_trig_table_create(acc->theta_dim);
+    if (!acc->votes || count < 0 || !trig) {
+        free(points);
+        hough_trig_table_free(trig);
+        hough_accumulator_free(acc);
+        return NULL;
+    }
+
+    HoughVoteContext ctx = {points, count, trig, opts->use_fixed_point, acc->rho_dim,
+                            acc->theta_dim, acc->rho_offset, acc->votes, NULL, NULL, 0,
+                            NULL, NULL, NULL};
+
+    // Vote contraint par le gradient : angle central de chaque point
+    int *center = NULL;
+    if (opts->gradient) {
+        if (opts->gradient->width != w || opts->gradient->height != h) {
+            fprintf(stderr, "hough_accumulate: Le gradient n'a pas les dimensions de l'image.\n");
+            free(points);
+            hough_trig_table_free(trig);
+            hough_accumulator_free(acc);
+            return NULL;
+        }
+        center = _gradient_theta_bins(points, count, opts->gradient, acc->theta_dim);
+        if (!center) {
+            free(points);
+            hough_trig_table_free(trig);
+            hough_accumulator_free(acc);
+            return NULL;
         }
+        int half_window = (int)(opts->gradient_tolerance * acc->theta_dim / 180.0);
+        if (half_window < 0) half_window = 0;
+        // Une fenêtre plus large que le demi-tour ferait voter deux fois le même angle
+        if (2 * half_window + 1 > acc->theta_dim) half_window = (acc->theta_dim - 1) / 2;
+        ctx.center = center;
+        ctx.half_window = half_window;
     }
 
-    // 4. Détecter les lignes (Pics) et dessiner sur l'image de sortie
-    Image *output = createImage(w, h, 1);
-    // On copie l'image de contour originale en fond (assombrie pour bien voir les lignes)
-    for(int i=0; i<w*h; i++) output->data[i] = edge_img->data[i] / 3;
+    // 2. Choix du découpage : accumulateurs privés s'ils tiennent dans le budget
+    size_t acc_bytes = (size_t)acc->rho_dim * acc->theta_dim * sizeof(int);
+    int point_threads = parallel_thread_count(count, 1024);
+    int theta_threads = parallel_thread_count(acc->theta_dim, 4);
+    HoughParallelMode mode = opts->parallel_mode;
+    if (mode == HOUGH_PARALLEL_AUTO) {
+        mode = (point_threads > 1 && acc_bytes * point_threads <= HOUGH_PRIVATE_ACC_BUDGET)
+                   ? HOUGH_PARALLEL_POINTS : HOUGH_PARALLEL_THETA;
+    }
+
+    int status = 0;
+    if (mode == HOUGH_PARALLEL_POINTS && point_threads > 1) {
+        // Tableau terminé par NULL ; le thread 0 vote directement dans l'accumulateur final
+        ctx.private_votes = calloc(point_threads + 1, sizeof(int *));
+        if (!ctx.private_votes) status = -1;
+        for (int t = 0; status == 0 && t < point_threads; t++) {
+            ctx.private_votes[t] = t == 0 ? acc->votes : calloc((size_t)acc->rho_dim * acc->theta_dim, sizeof(int));
+            if (!ctx.private_votes[t]) status = -1;
+        }
+        if (status == 0) {
+            parallel_for(count, point_threads, _points_worker, &ctx);
+            parallel_for(acc->theta_dim, parallel_thread_count(acc->theta_dim, 4), _reduce_worker, &ctx);
+        }
+        if (ctx.private_votes) {
+            for (int t = 1; t < point_threads; t++) free(ctx.private_votes[t]);
+            free(ctx.private_votes);
+        }
+    } else {
+        HoughPoint *bucket_points = NULL;
+        int *bucket_center = NULL;
+        int *bucket_start = NULL;
+        if (ctx.center && _bucket_by_center(&ctx, &bucket_points, &bucket_center, &bucket_start) != 0) {
+            status = -1;
+        }
+        if (status == 0) {
+            ctx.bucket_points = bucket_points;
+            ctx.bucket_center = bucket_center;
+            ctx.bucket_start = bucket_start;
+            parallel_for(acc->theta_dim, theta_threads, _theta_worker, &ctx);
+        }
+        free(bucket_points);
+        free(bucket_center);
+        free(bucket_start);
+    }
+
+    free(center);
+    free(points);
+    hough_trig_table_free(trig);
+    if (status != 0) {
+        hough_accumulator_free(acc);
+        return NULL;
+    }
+    return acc;
+}
+
+Image *hough_accumulator_image(const HoughAccumulator *acc) {
+    if (!acc) return NULL;
+    Image *view = createImage(acc->theta_dim, acc->rho_dim, 1);
+    if (!view) return NULL;
+
+    size_t total = (size_t)acc->rho_dim * acc->theta_dim;
+    int max_vote = 0;
+    for (size_t i = 0; i < total; i++) {
+        if (acc->votes[i] > max_vote) max_vote = acc->votes[i];
+    }
+
+    // Normalisation pour affichage (rho en ligne, theta en colonne)
+    for (int t = 0; t < acc->theta_dim; t++) {
+        const int *column = acc->votes + (size_t)t * acc->rho_dim;
+        for (int r = 0; r < acc->rho_dim; r++) {
+            view->data[(size_t)r * acc->theta_dim + t] =
+                max_vote > 0 ? (uint8_t)((column[r] * 255) / max_vote) : 0;
+        }
+    }
+    return view;
+}
+
+// --- Transformée de Hough probabiliste progressive ---
+
+// États des pixels de contour pendant le tirage
+#define PPHT_ABSENT 0   // Pas un contour, ou déjà retiré
+#define PPHT_PENDING 1  // Contour pas encore tiré
+#define PPHT_VOTED 2    // Contour tiré, ses votes sont dans l'accumulateur
+
+// Générateur xorshift32 : rapide et reproductible (graine fixe)
+static uint32_t _xorshift32(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// Ajoute 'delta' (+1 ou -1) aux votes du point (x, y) pour tous les angles.
+// Retourne l'angle de la case la plus votée (et son score) si delta > 0.
+static void _ppht_vote(const HoughTrigTable *trig, int *votes, int rho_dim, double rho_offset,
+                       int x, int y, int delta, int *best_t, int *best_votes) {
+    for (int t = 0; t < trig->theta_dim; t++) {
+        double rho = x * trig->cos_t[t] + y * trig->sin_t[t];
+        int rho_idx = (int)(rho + rho_offset);
+        if (rho_idx >= 0 && rho_idx < rho_dim) {
+            int *cell = votes + (size_t)t * rho_dim + rho_idx;
+            *cell += delta;
+            if (best_votes && *cell > *best_votes) {
+                *best_votes = *cell;
+                *best_t = t;
+            }
+        }
+    }
+}
+
+// Suit la droite d'angle t passant par (x0, y0) dans une direction (sign = +1 ou -1),
+// en avançant d'un pixel sur l'axe principal. Retourne la dernière position trouvée
+// dans le masque avant un trou de plus de max_gap pixels ou la sortie de l'image.
+static void _ppht_walk(const uint8_t *mask, int w, int h, double c, double s, int x0, int y0,
+                       int sign, int max_gap, int *end_x, int *end_y) {
+    // Direction de la droite : perpendiculaire à la normale (cos, sin)
+    double dx = -s * sign;
+    double dy = c * sign;
+    double step = fabs(dx) > fabs(dy) ? fabs(dx) : fabs(dy);
+    dx /= step;
+    dy /= step;
+
+    int gap = 0;
+    *end_x = x0;
+    *end_y = y0;
+    for (int k = 1;; k++) {
+        int x = (int)lround(x0 + k * dx);
+        int y = (int)lround(y0 + k * dy);
+        if (x < 0 || x >= w || y < 0 || y >= h) break;
+        if (mask[(size_t)y * w + x] != PPHT_ABSENT) {
+            gap = 0;
+            *end_x = x;
+            *end_y = y;
+        } else if (++gap > max_gap) {
+            break;
+        }
+    }
+}
+
+int hough_probabilistic(const Image *edge_img, const HoughOptions *opts, int threshold,
+                        int min_length, int max_gap, HoughSegment **out_segments, long *out_votes) {
+    if (!edge_img || !edge_img->data || !out_segments || threshold <= 0) return -1;
+    HoughOptions defaults;
+    if (!opts) {
+        hough_default_options(&defaults);
+        opts = &defaults;
+    }
+
+    int w = edge_img->width;
+    int h = edge_img->height;
+    double rho_offset = sqrt(w * w + h * h);
+    int rho_dim = (int)(rho_offset * 2);
+    int theta_dim = opts->theta_dim;
 
-    for (int r = 0; r < rho_dim; r++) {
-        for (int t = 0; t < theta_dim; t++) {
-            int votes = acc[r * theta_dim + t];
-            
-            if (votes >= threshold) {
-                // C'est une ligne valide !
-                // On vérifie si c'est un pic local (optionnel mais mieux)
-                // Ici on fait simple : seuil dur.
-                
-                double rho = r - hough_h; // Retirer le décalage
-                double theta = t * M_PI / 180.0;
-                
-                draw_line_polar(output, rho, theta);
+    HoughPoint *points = NULL;
+    int count = hough_collect_edge_points(edge_img, &points);
+    HoughTrigTable *trig = hough_trig_table_create(theta_dim);
+    int *votes = calloc((size_t)rho_dim * theta_dim, sizeof(int));
+    uint8_t *mask = calloc((size_t)w * h, 1);
+    int capacity = 16;
+    HoughSegment *segments = malloc(capacity * sizeof(HoughSegment));
+    if (count < 0 || !trig || !votes || !mask || !segments) {
+        free(points);
+        hough_trig_table_free(trig);
+        free(votes);
+        free(mask);
+        free(segments);
+        return -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        mask[(size_t)points[i].y * w + points[i].x] = PPHT_PENDING;
+    }
+
+    // Ordre aléatoire (Fisher-Yates)
+    uint32_t rng = 0x9E3779B9u;
+    for (int i = count - 1; i > 0; i--) {
+        int j = (int)(_xorshift32(&rng) % (uint32_t)(i + 1));
+        HoughPoint tmp = points[i];
+        points[i] = points[j];
+        points[j] = tmp;
+    }
+
+    int seg_count = 0;
+    long voters = 0;
+    for (int i = 0; i < count; i++) {
+        int x0 = points[i].x;
+        int y0 = points[i].y;
+        // Le point a pu être retiré avec un segment détecté entre-temps
+        if (mask[(size_t)y0 * w + x0] != PPHT_PENDING) continue;
+
+        // 1. Vote du point tiré
+        int best_t = 0, best_votes = 0;
+        _ppht_vote(trig, votes, rho_dim, rho_offset, x0, y0, 1, &best_t, &best_votes);
+        mask[(size_t)y0 * w + x0] = PPHT_VOTED;
+        voters++;
+        if (best_votes < threshold) continue;
+
+        // 2. Une droite est apparue : on cherche ses extrémités dans l'image
+        double c = trig->cos_t[best_t];
+        double s = trig->sin_t[best_t];
+        int ax, ay, bx, by;
+        _ppht_walk(mask, w, h, c, s, x0, y0, 1, max_gap, &ax, &ay);
+        _ppht_walk(mask, w, h, c, s, x0, y0, -1, max_gap, &bx, &by);
+        int length_sq = (ax - bx) * (ax - bx) + (ay - by) * (ay - by);
+        int good_line = length_sq >= min_length * min_length;
+
+        // 3. Retirer les pixels du segment (et leurs votes si le segment est retenu)
+        int dx = abs(ax - bx), dy = abs(ay - by);
+        int steps = dx > dy ? dx : dy;
+        for (int k = 0; k <= steps; k++) {
+            int x = steps ? bx + (int)lround((double)(ax - bx) * k / steps) : bx;
+            int y = steps ? by + (int)lround((double)(ay - by) * k / steps) : by;
+            uint8_t *m = &mask[(size_t)y * w + x];
+            if (*m == PPHT_VOTED && good_line) {
+                _ppht_vote(trig, votes, rho_dim, rho_offset, x, y, -1, NULL, NULL);
+            }
+            *m = PPHT_ABSENT;
+        }
+
+        if (good_line) {
+            if (seg_count == capacity) {
+                capacity *= 2;
+                HoughSegment *grown = realloc(segments, capacity * sizeof(HoughSegment));
+                if (!grown) {
+                    free(segments);
+                    segments = NULL;
+                    break;
+                }
+                segments = grown;
             }
+            segments[seg_count].x1 = bx;
+            segments[seg_count].y1 = by;
+            segments[seg_count].x2 = ax;
+            segments[seg_count].y2 = ay;
+            segments[seg_count].votes = best_votes;
+            seg_count++;
+        }
+    }
+
+    free(points);
+    hough_trig_table_free(trig);
+    free(votes);
+    free(mask);
+    if (!segments) return -1;
+    if (out_votes) *out_votes = voters;
+    *out_segments = segments;
+    return seg_count;
+}
+
+void hough_draw_segments(Image *img, const HoughSegment *segments, int count) {
+    if (!img || !segments) return;
+    int w = img->width;
+    int h = img->height;
+    for (int i = 0; i < count; i++) {
+        // Bresenham
+        int x = segments[i].x1, y = segments[i].y1;
+        int x2 = segments[i].x2, y2 = segments[i].y2;
+        int dx = abs(x2 - x), sx = x < x2 ? 1 : -1;
+        int dy = -abs(y2 - y), sy = y < y2 ? 1 : -1;
+        int err = dx + dy;
+        for (;;) {
+            if (x >= 0 && x < w && y >= 0 && y < h) img->data[(size_t)y * w + x] = 255;
+            if (x == x2 && y == y2) break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x += sx; }
+            if (e2 <= dx) { err += dx; y += sy; }
         }
     }
+}
 
-    free(acc);
-    printf("Transformée de Hough terminée.\n");
+// --- Extraction des pics ---
+
+typedef struct {
+    int votes;
+    int index;  // t * rho_dim + r : départage les égalités (le plus petit gagne)
+} HoughPeak;
+
+// Vrai si a est "moins bon" que b (racine du tas min = pire pic gardé)
+static int _peak_worse(const HoughPeak *a, const HoughPeak *b) {
+    if (a->votes != b->votes) return a->votes < b->votes;
+    return a->index > b->index;
+}
+
+static void _heap_sift_down(HoughPeak *heap, int size, int i) {
+    for (;;) {
+        int smallest = i;
+        int l = 2 * i + 1, r = 2 * i + 2;
+        if (l < size && _peak_worse(&heap[l], &heap[smallest])) smallest = l;
+        if (r < size && _peak_worse(&heap[r], &heap[smallest])) smallest = r;
+        if (smallest == i) return;
+        HoughPeak tmp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+static void _heap_sift_up(HoughPeak *heap, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!_peak_worse(&heap[i], &heap[parent])) return;
+        HoughPeak tmp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+// Vrai si la case (t, r) est le maximum de sa fenêtre. theta est cyclique :
+// (theta + 180°, rho) est la droite (theta, -rho), la fenêtre qui sort de
+// [0, theta_dim[ continue donc de l'autre côté, avec l'indice rho miroir.
+static int _is_local_max(const HoughAccumulator *acc, int t, int r, int radius) {
+    int v = acc->votes[(size_t)t * acc->rho_dim + r];
+    int t_radius = radius < (acc->theta_dim - 1) / 2 ? radius : (acc->theta_dim - 1) / 2;
+    for (int dt = -t_radius; dt <= t_radius; dt++) {
+        int nt = t + dt;
+        int center = r;
+        if (nt < 0 || nt >= acc->theta_dim) {
+            nt = nt < 0 ? nt + acc->theta_dim : nt - acc->theta_dim;
+            center = acc->rho_dim - 1 - r;
+        }
+        int r0 = center - radius < 0 ? 0 : center - radius;
+        int r1 = center + radius >= acc->rho_dim ? acc->rho_dim - 1 : center + radius;
+        const int *column = acc->votes + (size_t)nt * acc->rho_dim;
+        for (int nr = r0; nr <= r1; nr++) {
+            int n = column[nr];
+            if (n > v) return 0;
+            // Égalité : seule la première case dans l'ordre de parcours est gardée
+            if (n == v && (nt < t || (nt == t && nr < r))) return 0;
+        }
+    }
+    return 1;
+}
+
+int hough_find_peaks(const HoughAccumulator *acc, int threshold, int nms_radius,
+                     int max_lines, HoughLine *out_lines) {
+    if (!acc || !out_lines || max_lines <= 0) return -1;
+    if (nms_radius < 0) nms_radius = 0;
+
+    HoughPeak *heap = malloc(max_lines * sizeof(HoughPeak));
+    if (!heap) return -1;
+    int size = 0;
+
+    for (int t = 0; t < acc->theta_dim; t++) {
+        const int *column = acc->votes + (size_t)t * acc->rho_dim;
+        for (int r = 0; r < acc->rho_dim; r++) {
+            int v = column[r];
+            if (v < threshold) continue;
+            HoughPeak p = {v, t * acc->rho_dim + r};
+            // Tas plein et pas meilleur que le pire : inutile de tester la fenêtre
+            if (size == max_lines && !_peak_worse(&heap[0], &p)) continue;
+            if (nms_radius > 0 && !_is_local_max(acc, t, r, nms_radius)) continue;
+
+            if (size < max_lines) {
+                heap[size] = p;
+                _heap_sift_up(heap, size++);
+            } else {
+                heap[0] = p;
+                _heap_sift_down(heap, size, 0);
+            }
+        }
+    }
+
+    // Vider le tas : le pire sort en premier, on remplit donc par la fin
+    int count = size;
+    while (size > 0) {
+        HoughPeak p = heap[0];
+        heap[0] = heap[--size];
+        _heap_sift_down(heap, size, 0);
+
+        int t = p.index / acc->rho_dim;
+        int r = p.index % acc->rho_dim;
+        out_lines[size].rho = r - acc->rho_offset;
+        out_lines[size].theta = t * M_PI / acc->theta_dim;
+        out_lines[size].votes = p.votes;
+    }
+
+    free(heap);
+    return count;
+}
+
+void hough_draw_lines(Image *img, const HoughLine *lines, int count) {
+    if (!img || !lines) return;
+    for (int i = 0; i < count; i++) {
+        draw_line_polar(img, lines[i].rho, lines[i].theta);
+    }
+}
+
+Image *hough_transform(const Image *edge_img, Image **accumulator_view, int threshold) {
+    return hough_transform_ex(edge_img, accumulator_view, threshold, NULL);
+}
+
+Image *hough_transform_ex(const Image *edge_img, Image **accumulator_view, int threshold,
+                          const HoughOptions *opts) {
+    if (!edge_img) return NULL;
+
+    int w = edge_img->width;
+    int h = edge_img->height;
+
+    // 1-2. Vote (liste de points, tables précalculées)
+    HoughAccumulator *acc = hough_accumulate(edge_img, opts);
+    if (!acc) return NULL;
+
+    // 3. (Optionnel) Créer l'image de visualisation de l'accumulateur (Hough Space)
+    if (accumulator_view) {
+        *accumulator_view = hough_accumulator_image(acc);
+    }
+
+    // 4. Détecter les lignes (pics locaux les plus votés)
+    HoughLine lines[HOUGH_MAX_LINES];
+    int line_count = hough_find_peaks(acc, threshold, HOUGH_NMS_RADIUS, HOUGH_MAX_LINES, lines);
+    hough_accumulator_free(acc);
+    if (line_count < 0) return NULL;
+
+    // 5. Dessiner sur l'image de sortie
+    Image *output = createImage(w, h, 1);
+    if (!output) return NULL;
+    // On copie l'image de contour originale en fond (assombrie pour bien voir les lignes)
+    for(int i=0; i<w*h; i++) output->data[i] = edge_img->data[i] / 3;
+    hough_draw_lines(output, lines, line_count);
+
+    printf("Transformée de Hough terminée (%d ligne(s) détectée(s)).\n", line_count);
     return output;
-}
\ No newline at end of file
+}
@@ -0,0 +1,279 @@
+#include "analysis/hough_circle.h"
+#include "filters/predefined_filters.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+void hough_circle_default_params(HoughCircleParams *params, int min_radius, int max_radius) {
+    params->min_radius = min_radius;
+    params->max_radius = max_radius;
+    params->edge_threshold = 100.0;
+    params->center_threshold = 20;
+    params->min_support = 0.4;
+    params->min_distance = min_radius;
+    params->max_circles = 64;
+}
+
+typedef struct {
+    int x;
+    int y;
+} EdgePixel;
+
+typedef struct {
+    int index;  // y * width + x
+    int votes;
+} CenterCandidate;
+
+// Tri des centres par votes décroissants (à égalité, ordre de balayage)
+static int compare_candidates(const void *a, const void *b) {
+    const CenterCandidate *c1 = (const CenterCandidate *)a;
+    const CenterCandidate *c2 = (const CenterCandidate *)b;
+    if (c1->votes != c2->votes) return c2->votes - c1->votes;
+    return c1->index - c2->index;
+}
+
+// Étape 1 : chaque pixel de contour vote le long de la droite portée par son
+// gradient, de part et d'autre, pour les distances [rmin, rmax].
+static void _vote_centers(const EdgePixel *edges, int count, const GradientField *g,
+                          int rmin, int rmax, int *acc, int w, int h) {
+    for (int i = 0; i < count; i++) {
+        int x = edges[i].x;
+        int y = edges[i].y;
+        size_t idx = (size_t)y * w + x;
+        float gx = g->gx[idx];
+        float gy = g->gy[idx];
+        float norm = sqrtf(gx * gx + gy * gy);
+        float dx = gx / norm;
+        float dy = gy / norm;
+
+        for (int sign = -1; sign <= 1; sign += 2) {
+            // Avancée incrémentale le long du rayon (pas de 1 pixel)
+            float cx = x + sign * dx * rmin;
+            float cy = y + sign * dy * rmin;
+            float sx = sign * dx;
+            float sy = sign * dy;
+            int last = -1;
+            for (int r = rmin; r <= rmax; r++, cx += sx, cy += sy) {
+                int px = (int)lroundf(cx);
+                int py = (int)lroundf(cy);
+                if (px < 0 || px >= w || py < 0 || py >= h) break;
+                int cell = py * w + px;
+                if (cell != last) { // Un même pixel ne reçoit qu'un vote par rayon
+                    acc[cell]++;
+                    last = cell;
+                }
+            }
+        }
+    }
+}
+
+// Étape 2 : centres candidats = maxima locaux 3x3 au-dessus du seuil, triés
+static CenterCandidate *_find_center_candidates(const int *acc, int w, int h, int threshold, int *out_count) {
+    int count = 0, capacity = 256;
+    CenterCandidate *candidates = malloc(capacity * sizeof(CenterCandidate));
+    if (!candidates) return NULL;
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int v = acc[y * w + x];
+            if (v < threshold || v == 0) continue;
+            int is_max = 1;
+            for (int ny = y - 1; ny <= y + 1 && is_max; ny++) {
+                for (int nx = x - 1; nx <= x + 1; nx++) {
+                    if (nx < 0 || nx >= w || ny < 0 || ny >= h || (nx == x && ny == y)) continue;
+                    int n = acc[ny * w + nx];
+                    // Égalité : le premier dans l'ordre de balayage l'emporte
+                    if (n > v || (n == v && (ny < y || (ny == y && nx < x)))) {
+                        is_max = 0;
+                        break;
+                    }
+                }
+            }
+            if (!is_max) continue;
+            if (count == capacity) {
+                capacity *= 2;
+                CenterCandidate *grown = realloc(candidates, capacity * sizeof(CenterCandidate));
+                if (!grown) {
+                    free(candidates);
+                    return NULL;
+                }
+                candidates = grown;
+            }
+            candidates[count].index = y * w + x;
+            candidates[count].votes = v;
+            count++;
+        }
+    }
+    qsort(candidates, count, sizeof(CenterCandidate), compare_candidates);
+    *out_count = count;
+    return candidates;
+}
+
+// Étape 3 : rayon d'un centre = pic de l'histogramme des distances des
+// contours proches, rapporté au périmètre (les grands cercles ont plus de
+// pixels). Seules les lignes [cy - rmax, cy + rmax] sont parcourues.
+static int _estimate_radius(const EdgePixel *edges, const int *row_start, int h, int cx, int cy,
+                            int rmin, int rmax, int *histogram, double *out_support) {
+    memset(histogram, 0, (rmax + 1) * sizeof(int));
+    int y0 = cy - rmax < 0 ? 0 : cy - rmax;
+    int y1 = cy + rmax >= h ? h - 1 : cy + rmax;
+    long limit_sq = (long)(rmax + 1) * (rmax + 1);
+    for (int i = row_start[y0]; i < row_start[y1 + 1]; i++) {
+        long dx = edges[i].x - cx, dy = edges[i].y - cy;
+        long d_sq = dx * dx + dy * dy;
+        if (d_sq >= limit_sq) continue;
+        int r = (int)lround(sqrt((double)d_sq));
+        if (r >= rmin && r <= rmax) histogram[r]++;
+    }
+
+    int best_r = 0;
+    double best_support = 0.0;
+    for (int r = rmin; r <= rmax; r++) {
+        double support = histogram[r] / (2.0 * M_PI * r);
+        if (support > best_support) {
+            best_support = support;
+            best_r = r;
+        }
+    }
+    *out_support = best_support;
+    return best_r;
+}
+
+int hough_circles(const Image *src, const HoughCircleParams *params, HoughCircle **out_circles) {
+    if (!src || !src->data || src->channels != 1 || !params || !out_circles) {
+        fprintf(stderr, "hough_circles: Arguments invalides.\n");
+        return -1;
+    }
+    int rmin = params->min_radius < 1 ? 1 : params->min_radius;
+    int rmax = params->max_radius;
+    if (rmax < rmin || params->max_circles <= 0) {
+        fprintf(stderr, "hough_circles: Plage de rayons invalide [%d, %d].\n", rmin, rmax);
+        return -1;
+    }
+    int w = src->width;
+    int h = src->height;
+
+    GradientField *g = compute_sobel_gradient(src);
+    EdgePixel *edges = malloc((size_t)w * h * sizeof(EdgePixel));
+    int *row_start = malloc((h + 1) * sizeof(int));
+    int *acc = calloc((size_t)w * h, sizeof(int));
+    int *histogram = malloc((rmax + 1) * sizeof(int));
+    HoughCircle *circles = malloc(params->max_circles * sizeof(HoughCircle));
+    if (!g || !edges || !row_start || !acc || !histogram || !circles) {
+        free_gradient_field(g);
+        free(edges);
+        free(row_start);
+        free(acc);
+        free(histogram);
+        free(circles);
+        return -1;
+    }
+
+    // Pixels de contour, rangés par ligne (row_start[y] = premier pixel de la ligne y)
+    double thr_sq = params->edge_threshold * params->edge_threshold;
+    int count = 0;
+    for (int y = 0; y < h; y++) {
+        row_start[y] = count;
+        for (int x = 0; x < w; x++) {
+            size_t idx = (size_t)y * w + x;
+            double mag_sq = (double)g->gx[idx] * g->gx[idx] + (double)g->gy[idx] * g->gy[idx];
+            if (mag_sq >= thr_sq && mag_sq > 0) {
+                edges[count].x = x;
+                edges[count].y = y;
+                count++;
+            }
+        }
+    }
+    row_start[h] = count;
+
+    // 1. Accumulateur des centres
+    _vote_centers(edges, count, g, rmin, rmax, acc, w, h);
+
+    // 2. Centres candidats
+    int cand_count = 0;
+    CenterCandidate *candidates = _find_center_candidates(acc, w, h, params->center_threshold, &cand_count);
+
+    // 3. Rayon de chaque centre, du plus voté au moins voté
+    int found = 0;
+    long min_dist_sq = (long)params->min_distance * params->min_distance;
+    for (int c = 0; candidates && c < cand_count && found < params->max_circles; c++) {
+        int cx = candidates[c].index % w;
+        int cy = candidates[c].index / w;
+
+        int too_close = 0;
+        for (int k = 0; k < found && !too_close; k++) {
+            long dx = circles[k].x - cx, dy = circles[k].y - cy;
+            if (dx * dx + dy * dy < min_dist_sq) too_close = 1;
+        }
+        if (too_close) continue;
+
+        double support;
+        int r = _estimate_radius(edges, row_start, h, cx, cy, rmin, rmax, histogram, &support);
+        if (r == 0 || support < params->min_support) continue;
+
+        circles[found].x = cx;
+        circles[found].y = cy;
+        circles[found].radius = r;
+        circles[found].votes = histogram[r];
+        found++;
+    }
+
+    // Sortie par votes du rayon décroissants. Tri par insertion stable : à
+    // égalité, l'ordre des votes du centre est conservé (found <= max_circles).
+    for (int i = 1; i < found; i++) {
+        HoughCircle current = circles[i];
+        int j = i - 1;
+        while (j >= 0 && circles[j].votes < current.votes) {
+            circles[j + 1] = circles[j];
+            j--;
+        }
+        circles[j + 1] = current;
+    }
+
+    int status = candidates ? 0 : -1;
+    free_gradient_field(g);
+    free(edges);
+    free(row_start);
+    free(acc);
+    free(histogram);
+    free(candidates);
+    if (status != 0) {
+        free(circles);
+        return -1;
+    }
+    *out_circles = circles;
+    return found;
+}
+
+static void _plot(Image *img, int x, int y) {
+    if (x >= 0 && x < img->width && y >= 0 && y < img->height) {
+        img->data[(size_t)y * img->width + x] = 255;
+    }
+}
+
+void hough_draw_circles(Image *img, const HoughCircle *circles, int count) {
+    if (!img || !circles) return;
+    for (int i = 0; i < count; i++) {
+        int cx = circles[i].x, cy = circles[i].y;
+        int x = circles[i].radius, y = 0;
+        int err = 1 - x;
+        while (x >= y) {
+            _plot(img, cx + x, cy + y); _plot(img, cx - x, cy + y);
+            _plot(img, cx + x, cy - y); _plot(img, cx - x, cy - y);
+            _plot(img, cx + y, cy + x); _plot(img, cx - y, cy + x);
+            _plot(img, cx + y, cy - x); _plot(img, cx - y, cy - x);
+            y++;
+            if (err < 0) {
+                err += 2 * y + 1;
+            } else {
+                x--;
+                err += 2 * (y - x) + 1;
+            }
+        }
+    }
+}
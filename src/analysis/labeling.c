@@ -0,0 +1,383 @@
+#include "analysis/labeling.h"
+#include "core/parallel.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+// Lignes (de pixels en 4-connexité, de blocs en 8-connexité) minimales par bande
+#define CCL_MIN_ROWS_PER_STRIP 16
+
+LabelImage *label_image_create(int width, int height) {
+    if (width <= 0 || height <= 0) return NULL;
+    LabelImage *labels = malloc(sizeof(LabelImage));
+    if (!labels) return NULL;
+    labels->width = width;
+    labels->height = height;
+    labels->labels = calloc((size_t)width * height, sizeof(uint32_t));
+    if (!labels->labels) {
+        free(labels);
+        return NULL;
+    }
+    return labels;
+}
+
+void label_image_free(LabelImage *labels) {
+    if (!labels) return;
+    free(labels->labels);
+    free(labels);
+}
+
+// --- Union-find (racine = plus petite étiquette, donc parent[i] <= i) ---
+
+static uint32_t _find_root(uint32_t *parent, uint32_t i) {
+    uint32_t root = i;
+    while (parent[root] != root) root = parent[root];
+    // Compression de chemin
+    while (parent[i] != root) {
+        uint32_t next = parent[i];
+        parent[i] = root;
+        i = next;
+    }
+    return root;
+}
+
+static uint32_t _union(uint32_t *parent, uint32_t a, uint32_t b) {
+    uint32_t ra = _find_root(parent, a);
+    uint32_t rb = _find_root(parent, b);
+    if (ra < rb) {
+        parent[rb] = ra;
+        return ra;
+    }
+    parent[ra] = rb;
+    return rb;
+}
+
+// Accumulateurs d'une composante pendant la seconde passe
+typedef struct {
+    long area;
+    double sum_x, sum_y, sum_i;
+    int min_x, min_y, max_x, max_y;
+} ComponentAccumulator;
+
+typedef struct {
+    const uint8_t *mask;
+    const uint8_t *intensity;
+    int width;
+    int height;
+    int block_mode;           // 1 : blocs 2x2 (8-connexité), 0 : pixels (4-connexité)
+    int row_units;            // Lignes de blocs ou de pixels
+    uint32_t labels_per_row;  // Borne du nombre d'étiquettes créées par ligne
+    uint32_t *labels;         // Étiquettes provisoires puis finales
+    uint32_t *parent;         // Union-find, indexé par étiquette provisoire
+    int *strip_begin;         // Première ligne de chaque bande (-1 si vide)
+    uint32_t *strip_used;     // Étiquettes provisoires créées par chaque bande
+    ComponentAccumulator **acc; // Accumulateurs par thread (seconde passe)
+} LabelingContext;
+
+static inline int _fg(const LabelingContext *c, int x, int y) {
+    return x < c->width && y < c->height && c->mask[(size_t)y * c->width + x] != 0;
+}
+
+static inline uint32_t _new_label(LabelingContext *c, uint32_t first, uint32_t *used) {
+    uint32_t l = first + (*used)++;
+    c->parent[l] = l;
+    return l;
+}
+
+// Première passe en 4-connexité sur les lignes de pixels [begin, end)
+static void _scan_pixels(void *ctx, int begin, int end, int thread_id) {
+    LabelingContext *c = ctx;
+    int w = c->width;
+    uint32_t first = 1 + (uint32_t)begin * c->labels_per_row;
+    uint32_t used = 0;
+
+    for (int y = begin; y < end; y++) {
+        const uint8_t *m = c->mask + (size_t)y * w;
+        uint32_t *row = c->labels + (size_t)y * w;
+        uint32_t *up = y > begin ? row - w : NULL; // La ligne précédente d'une autre bande est fusionnée plus tard
+        for (int x = 0; x < w; x++) {
+            if (!m[x]) {
+                row[x] = 0;
+                continue;
+            }
+            uint32_t left = x > 0 ? row[x - 1] : 0;
+            uint32_t top = up ? up[x] : 0;
+            if (left && top) {
+                row[x] = left == top ? left : _union(c->parent, left, top);
+            } else if (left || top) {
+                row[x] = left ? left : top;
+            } else {
+                row[x] = _new_label(c, first, &used);
+            }
+        }
+    }
+    c->strip_begin[thread_id] = begin;
+    c->strip_used[thread_id] = used;
+}
+
+// Première passe en 8-connexité sur les lignes de blocs 2x2 [begin, end).
+// L'étiquette provisoire d'un bloc est rangée sur son pixel en haut à gauche.
+static void _scan_blocks(void *ctx, int begin, int end, int thread_id) {
+    LabelingContext *c = ctx;
+    int w = c->width;
+    int bw = (w + 1) / 2;
+    uint32_t first = 1 + (uint32_t)begin * c->labels_per_row;
+    uint32_t used = 0;
+
+    for (int by = begin; by < end; by++) {
+        int y = 2 * by;
+        uint32_t *row = c->labels + (size_t)y * w;
+        uint32_t *up = by > begin ? row - 2 * (size_t)w : NULL;
+        for (int bx = 0; bx < bw; bx++) {
+            int x = 2 * bx;
+            // Pixels du bloc : a b / c d
+            int a = _fg(c, x, y), b = _fg(c, x + 1, y);
+            int cc = _fg(c, x, y + 1), d = _fg(c, x + 1, y + 1);
+            if (!(a || b || cc || d)) {
+                row[x] = 0;
+                continue;
+            }
+
+            // Blocs voisins déjà visités : P (haut-gauche), Q (haut), R (haut-droite), S (gauche)
+            uint32_t neighbors[4];
+            int n = 0;
+            if (up) {
+                if (bx > 0 && a && _fg(c, x - 1, y - 1)) neighbors[n++] = up[x - 2];
+                if ((a || b) && (_fg(c, x, y - 1) || _fg(c, x + 1, y - 1))) neighbors[n++] = up[x];
+                if (bx + 1 < bw && b && _fg(c, x + 2, y - 1)) neighbors[n++] = up[x + 2];
+            }
+            if (bx > 0 && (a || cc) && (_fg(c, x - 1, y) || _fg(c, x - 1, y + 1))) neighbors[n++] = row[x - 2];
+
+            if (n == 0) {
+                row[x] = _new_label(c, first, &used);
+                continue;
+            }
+            uint32_t l = neighbors[0];
+            for (int k = 1; k < n; k++) {
+                if (neighbors[k] != l) l = _union(c->parent, l, neighbors[k]);
+            }
+            row[x] = l;
+        }
+    }
+    c->strip_begin[thread_id] = begin;
+    c->strip_used[thread_id] = used;
+}
+
+// Fusionne la première ligne d'une bande avec la dernière ligne de la précédente
+static void _merge_strip_boundary(LabelingContext *c, int unit_row) {
+    int w = c->width;
+    if (!c->block_mode) {
+        uint32_t *row = c->labels + (size_t)unit_row * w;
+        uint32_t *up = row - w;
+        for (int x = 0; x < w; x++) {
+            if (row[x] && up[x]) _union(c->parent, row[x], up[x]);
+        }
+        return;
+    }
+
+    int bw = (w + 1) / 2;
+    int y = 2 * unit_row;
+    uint32_t *row = c->labels + (size_t)y * w;
+    uint32_t *up = row - 2 * (size_t)w;
+    for (int bx = 0; bx < bw; bx++) {
+        int x = 2 * bx;
+        if (!row[x]) continue;
+        int a = _fg(c, x, y), b = _fg(c, x + 1, y);
+        if (bx > 0 && a && _fg(c, x - 1, y - 1)) _union(c->parent, row[x], up[x - 2]);
+        if ((a || b) && (_fg(c, x, y - 1) || _fg(c, x + 1, y - 1))) _union(c->parent, row[x], up[x]);
+        if (bx + 1 < bw && b && _fg(c, x + 2, y - 1)) _union(c->parent, row[x], up[x + 2]);
+    }
+}
+
+static inline void _accumulate(ComponentAccumulator *acc, int x, int y, uint8_t value) {
+    if (acc->area == 0) {
+        acc->min_x = acc->max_x = x;
+        acc->min_y = acc->max_y = y;
+    } else {
+        if (x < acc->min_x) acc->min_x = x;
+        if (x > acc->max_x) acc->max_x = x;
+        if (y < acc->min_y) acc->min_y = y;
+        if (y > acc->max_y) acc->max_y = y;
+    }
+    acc->area++;
+    acc->sum_x += x;
+    acc->sum_y += y;
+    acc->sum_i += value;
+}
+
+// Seconde passe : étiquettes finales et statistiques, sur les lignes [begin, end)
+static void _relabel(void *ctx, int begin, int end, int thread_id) {
+    LabelingContext *c = ctx;
+    int w = c->width;
+    ComponentAccumulator *acc = c->acc[thread_id];
+
+    for (int u = begin; u < end; u++) {
+        if (!c->block_mode) {
+            uint32_t *row = c->labels + (size_t)u * w;
+            for (int x = 0; x < w; x++) {
+                if (!row[x]) continue;
+                uint32_t l = c->parent[row[x]];
+                row[x] = l;
+                _accumulate(&acc[l - 1], x, u, c->intensity[(size_t)u * w + x]);
+            }
+            continue;
+        }
+
+        int y = 2 * u;
+        for (int x = 0; x < w; x += 2) {
+            uint32_t *cell = c->labels + (size_t)y * w + x;
+            uint32_t l = *cell ? c->parent[*cell] : 0;
+            for (int dy = 0; dy < 2 && y + dy < c->height; dy++) {
+                for (int dx = 0; dx < 2 && x + dx < w; dx++) {
+                    size_t idx = (size_t)(y + dy) * w + x + dx;
+                    if (l && c->mask[idx]) {
+                        c->labels[idx] = l;
+                        _accumulate(&acc[l - 1], x + dx, y + dy, c->intensity[idx]);
+                    } else {
+                        c->labels[idx] = 0;
+                    }
+                }
+            }
+        }
+    }
+}
+
+int label_components(const Image *mask, const Image *intensity, int connectivity,
+                     LabelImage **out_labels, ComponentStats **out_stats) {
+    if (!mask || !mask->data || mask->channels != 1 || !out_labels ||
+        (connectivity != 4 && connectivity != 8)) {
+        fprintf(stderr, "label_components: Arguments invalides.\n");
+        return -1;
+    }
+    if (intensity && (intensity->width != mask->width || intensity->height != mask->height ||
+                      intensity->channels != 1)) {
+        fprintf(stderr, "label_components: L'image d'intensité doit avoir les dimensions du masque.\n");
+        return -1;
+    }
+    int w = mask->width;
+    int h = mask->height;
+
+    LabelingContext c;
+    c.mask = mask->data;
+    c.intensity = intensity ? intensity->data : mask->data;
+    c.width = w;
+    c.height = h;
+    c.block_mode = connectivity == 8;
+    c.row_units = c.block_mode ? (h + 1) / 2 : h;
+    // Une nouvelle étiquette exige un voisin gauche éteint : au plus ceil(w/2) par ligne
+    c.labels_per_row = (uint32_t)((w + 1) / 2);
+    size_t max_labels = (size_t)c.row_units * c.labels_per_row + 1;
+    if (max_labels > UINT32_MAX) {
+        fprintf(stderr, "label_components: Image trop grande.\n");
+        return -1;
+    }
+
+    int num_strips = parallel_thread_count(c.row_units, CCL_MIN_ROWS_PER_STRIP);
+    LabelImage *labels = label_image_create(w, h);
+    c.labels = labels ? labels->labels : NULL;
+    c.parent = malloc(max_labels * sizeof(uint32_t));
+    c.strip_begin = malloc(num_strips * sizeof(int));
+    c.strip_used = calloc(num_strips, sizeof(uint32_t));
+    c.acc = calloc(num_strips, sizeof(ComponentAccumulator *));
+    if (!labels || !c.parent || !c.strip_begin || !c.strip_used || !c.acc) {
+        label_image_free(labels);
+        free(c.parent);
+        free(c.strip_begin);
+        free(c.strip_used);
+        free(c.acc);
+        return -1;
+    }
+    for (int s = 0; s < num_strips; s++) c.strip_begin[s] = -1;
+    c.parent[0] = 0;
+
+    // 1. Étiquettes provisoires, une bande par thread
+    parallel_for(c.row_units, num_strips, c.block_mode ? _scan_blocks : _scan_pixels, &c);
+
+    // 2. Fusion des jonctions entre bandes
+    for (int s = 1; s < num_strips; s++) {
+        if (c.strip_begin[s] > 0) _merge_strip_boundary(&c, c.strip_begin[s]);
+    }
+
+    // 3. Étiquettes finales consécutives. parent[i] <= i : en parcourant les
+    //    étiquettes dans l'ordre croissant, parent[parent[i]] est déjà définitif.
+    uint32_t count = 0;
+    for (int s = 0; s < num_strips; s++) {
+        if (c.strip_begin[s] < 0) continue;
+        uint32_t first = 1 + (uint32_t)c.strip_begin[s] * c.labels_per_row;
+        for (uint32_t i = first; i < first + c.strip_used[s]; i++) {
+            c.parent[i] = c.parent[i] == i ? ++count : c.parent[c.parent[i]];
+        }
+    }
+
+    // 4. Seconde passe : étiquettes finales et statistiques (accumulateurs par thread)
+    int ok = 1;
+    for (int s = 0; s < num_strips && ok; s++) {
+        c.acc[s] = calloc(count ? count : 1, sizeof(ComponentAccumulator));
+        if (!c.acc[s]) ok = 0;
+    }
+    if (ok) parallel_for(c.row_units, num_strips, _relabel, &c);
+
+    ComponentStats *stats = NULL;
+    if (ok && out_stats) {
+        stats = malloc((count ? count : 1) * sizeof(ComponentStats));
+        if (!stats) ok = 0;
+    }
+    if (stats) {
+        for (uint32_t l = 0; l < count; l++) {
+            ComponentAccumulator total = c.acc[0][l];
+            for (int s = 1; s < num_strips; s++) {
+                const ComponentAccumulator *a = &c.acc[s][l];
+                if (a->area == 0) continue;
+                if (total.area == 0) {
+                    total = *a;
+                    continue;
+                }
+                total.area += a->area;
+                total.sum_x += a->sum_x;
+                total.sum_y += a->sum_y;
+                total.sum_i += a->sum_i;
+                if (a->min_x < total.min_x) total.min_x = a->min_x;
+                if (a->max_x > total.max_x) total.max_x = a->max_x;
+                if (a->min_y < total.min_y) total.min_y = a->min_y;
+                if (a->max_y > total.max_y) total.max_y = a->max_y;
+            }
+            ComponentStats *st = &stats[l];
+            st->label = l + 1;
+            st->area = total.area;
+            st->min_x = total.min_x;
+            st->min_y = total.min_y;
+            st->max_x = total.max_x;
+            st->max_y = total.max_y;
+            st->centroid_x = total.sum_x / total.area;
+            st->centroid_y = total.sum_y / total.area;
+            st->mean_intensity = total.sum_i / total.area;
+        }
+    }
+
+    for (int s = 0; s < num_strips; s++) free(c.acc[s]);
+    free(c.acc);
+    free(c.parent);
+    free(c.strip_begin);
+    free(c.strip_used);
+
+    if (!ok) {
+        label_image_free(labels);
+        return -1;
+    }
+    *out_labels = labels;
+    if (out_stats) *out_stats = stats;
+    return (int)count;
+}
+
+Image *label_image_to_image(const LabelImage *labels) {
+    if (!labels || !labels->labels) return NULL;
+    Image *img = createImage(labels->width, labels->height, 1);
+    if (!img) return NULL;
+    size_t n = (size_t)labels->width * labels->height;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t l = labels->labels[i];
+        // Pas de 97 (premier avec 192) : deux étiquettes voisines ont des teintes éloignées
+        img->data[i] = l ? (uint8_t)(64 + (l * 97u) % 192u) : 0;
+    }
+    return img;
+}
@@ -1,11 +1,64 @@
 #include "analysis/segmentation.h"
+#include "analysis/bucket_queue.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 #include <stdbool.h>
+#include <string.h>
 
-// Structure simple pour un point
-typedef struct { int x, y; } Point;
+// Segment horizontal [x_left, x_right] de la ligne y, déjà rempli,
+// dont les lignes voisines restent à explorer
+typedef struct { int x_left, x_right, y; } Span;
+
+// Pile de segments, agrandie à la demande
+typedef struct {
+    Span *items;
+    int count;
+    int capacity;
+} SpanStack;
+
+static bool _span_push(SpanStack *stack, int x_left, int x_right, int y) {
+    if (stack->count == stack->capacity) {
+        int capacity = stack->capacity ? stack->capacity * 2 : 64;
+        Span *grown = realloc(stack->items, capacity * sizeof(Span));
+        if (!grown) return false;
+        stack->items = grown;
+        stack->capacity = capacity;
+    }
+    stack->items[stack->count++] = (Span){x_left, x_right, y};
+    return true;
+}
+
+// Explore la ligne y sous le segment [x_left, x_right] : chaque pixel accepté
+// non encore rempli est étendu en une course maximale, remplie puis empilée.
+// Retourne le nombre de pixels ajoutés, ou -1 en cas d'erreur d'allocation.
+static long _fill_row_under_span(const Image *src, Image *mask, SpanStack *stack,
+                                 int x_left, int x_right, int y, uint8_t seed_val, int tolerance) {
+    int w = src->width;
+    const uint8_t *row = src->data + (size_t)y * w;
+    uint8_t *mrow = mask->data + (size_t)y * w;
+    long added = 0;
+
+    int x = x_left;
+    while (x <= x_right) {
+        // Le masque sert d'ensemble "visité" : un pixel à 255 est déjà dans la région
+        if (mrow[x] || abs(row[x] - seed_val) > tolerance) {
+            x++;
+            continue;
+        }
+        // Étendre la course à gauche (peut dépasser x_left) puis à droite
+        int run_left = x;
+        while (run_left > 0 && !mrow[run_left - 1] && abs(row[run_left - 1] - seed_val) <= tolerance) run_left--;
+        int run_right = x;
+        while (run_right + 1 < w && !mrow[run_right + 1] && abs(row[run_right + 1] - seed_val) <= tolerance) run_right++;
+
+        memset(mrow + run_left, 255, run_right - run_left + 1);
+        added += run_right - run_left + 1;
+        if (!_span_push(stack, run_left, run_right, y)) return -1;
+        x = run_right + 2; // run_right + 1 est refusé ou déjà rempli
+    }
+    return added;
+}
 
 Image *region_growing(const Image *src, int seed_x, int seed_y, int tolerance) {
     if (!src || seed_x < 0 || seed_x >= src->width || seed_y < 0 || seed_y >= src->height) {
@@ -18,17 +71,8 @@ Image *region_growing(const Image *src, int seed_x, int seed_y, int tolerance) {
 
     // Image de sortie (Masque binaire : 0 = fond, 255 = région)
     Image *mask = createImage(w, h, 1);
-    // Initialiser à noir
-    for(int i=0; i<w*h; i++) mask->data[i] = 0;
-
-    // Tableau pour marquer les pixels visités (pour ne pas boucler)
-    bool *visited = (bool*)calloc(w * h, sizeof(bool));
-    
-    // File d'attente pour les pixels à traiter
-    // Taille max = nombre de pixels (pire cas)
-    Point *queue = (Point*)malloc(w * h * sizeof(Point));
-    int head = 0;
-    int tail = 0;
+    if (!mask) return NULL;
+    memset(mask->data, 0, (size_t)w * h);
 
     // Récupérer la valeur du germe
     // Note : On peut utiliser la valeur du pixel initial comme référence fixe,
@@ -36,47 +80,226 @@ Image *region_growing(const Image *src, int seed_x, int seed_y, int tolerance) {
     // Ici : référence fixe au germe.
     uint8_t seed_val = src->data[seed_y * w + seed_x];
 
-    // Ajouter le germe à la file
-    queue[tail++] = (Point){seed_x, seed_y};
-    visited[seed_y * w + seed_x] = true;
-    mask->data[seed_y * w + seed_x] = 255;
-
-    int region_size = 0;
-
-    // Boucle de remplissage (Flood Fill)
-    while (head < tail) {
-        Point p = queue[head++];
-        region_size++;
-
-        // Vérifier les 4 voisins (Haut, Bas, Gauche, Droite)
-        int dx[] = {0, 0, -1, 1};
-        int dy[] = {-1, 1, 0, 0};
-
-        for (int i = 0; i < 4; i++) {
-            int nx = p.x + dx[i];
-            int ny = p.y + dy[i];
-
-            // Vérifier les limites
-            if (nx >= 0 && nx < w && ny >= 0 && ny < h) {
-                int idx = ny * w + nx;
-                
-                if (!visited[idx]) {
-                    // Critère d'homogénéité (Prédicat)
-                    int val = src->data[idx];
-                    if (abs(val - seed_val) <= tolerance) {
-                        // Accepter le pixel dans la région
-                        visited[idx] = true;
-                        mask->data[idx] = 255;
-                        queue[tail++] = (Point){nx, ny};
-                    }
-                }
+    // Remplissage par segments (scanline) : on empile des courses horizontales
+    // plutôt que des pixels, et le masque lui-même marque les pixels visités.
+    // La mémoire auxiliaire se limite à la pile, proportionnelle au nombre de
+    // courses en attente (et non plus au nombre de pixels).
+    SpanStack stack = {NULL, 0, 0};
+    long region_size = _fill_row_under_span(src, mask, &stack, seed_x, seed_x, seed_y, seed_val, tolerance);
+
+    // Boucle de remplissage (Flood Fill, 4-connexité)
+    while (region_size >= 0 && stack.count > 0) {
+        Span span = stack.items[--stack.count];
+        for (int dy = -1; dy <= 1; dy += 2) {
+            int ny = span.y + dy;
+            if (ny < 0 || ny >= h) continue;
+            long added = _fill_row_under_span(src, mask, &stack, span.x_left, span.x_right, ny, seed_val, tolerance);
+            if (added < 0) {
+                region_size = -1;
+                break;
             }
+            region_size += added;
         }
     }
+    free(stack.items);
+
+    if (region_size < 0) {
+        fprintf(stderr, "Erreur: Allocation mémoire impossible pour la croissance de région.\n");
+        freeImage(mask);
+        return NULL;
+    }
 
-    printf("Région générée : %d pixels (Germe: %d,%d | Tolérance: %d)\n", region_size, seed_x, seed_y, tolerance);
+    printf("Région générée : %ld pixels (Germe: %d,%d | Tolérance: %d)\n", region_size, seed_x, seed_y, tolerance);
 
-    free(visited);
-    free(queue);
     return mask;
-}
\ No newline at end of file
+}
+
+// Marque un pixel en attente dans la file (ni fond, ni région)
+#define SRG_QUEUED UINT32_MAX
+
+typedef struct {
+    const uint8_t *data;
+    int width;
+    int height;
+    uint32_t *labels;
+    int tolerance;
+    RegionPredicate predicate;
+    const uint8_t *seed_values; // Valeur du germe de chaque région
+    long *sums;                 // Somme des intensités de chaque région
+    long *counts;               // Nombre de pixels de chaque région
+    BucketQueue *queue;
+} SRGContext;
+
+// Référence de la région (indice 0..n-1) à laquelle les candidats sont comparés
+static inline int _region_reference(const SRGContext *c, uint32_t region) {
+    if (c->predicate == REGION_PREDICATE_SEED) return c->seed_values[region];
+    return (int)((c->sums[region] + c->counts[region] / 2) / c->counts[region]);
+}
+
+// Place en file les voisins libres du pixel idx, qui vient de rejoindre la région label
+static int _srg_push_neighbors(SRGContext *c, int idx, uint32_t label) {
+    int w = c->width;
+    int x = idx % w, y = idx / w;
+    int neighbors[4];
+    int n = 0;
+    if (y > 0) neighbors[n++] = idx - w;
+    if (y + 1 < c->height) neighbors[n++] = idx + w;
+    if (x > 0) neighbors[n++] = idx - 1;
+    if (x + 1 < w) neighbors[n++] = idx + 1;
+
+    int ref = _region_reference(c, label - 1);
+    for (int k = 0; k < n; k++) {
+        int nidx = neighbors[k];
+        if (c->labels[nidx] != 0) continue;
+        int diff = abs(c->data[nidx] - ref);
+        if (diff > c->tolerance) continue;
+        c->labels[nidx] = SRG_QUEUED;
+        if (bucket_queue_push(c->queue, diff, nidx) != 0) return -1;
+    }
+    return 0;
+}
+
+static void _srg_add_pixel(SRGContext *c, int idx, uint32_t label) {
+    c->labels[idx] = label;
+    c->sums[label - 1] += c->data[idx];
+    c->counts[label - 1]++;
+}
+
+long region_growing_multi(const Image *src, const RegionSeed *seeds, int num_seeds, int tolerance,
+                          RegionPredicate predicate, LabelImage **out_labels) {
+    if (!src || !src->data || src->channels != 1 || !seeds || num_seeds <= 0 || tolerance < 0 || !out_labels) {
+        fprintf(stderr, "region_growing_multi: Arguments invalides.\n");
+        return -1;
+    }
+    int w = src->width;
+    int h = src->height;
+    for (int i = 0; i < num_seeds; i++) {
+        if (seeds[i].x < 0 || seeds[i].x >= w || seeds[i].y < 0 || seeds[i].y >= h) {
+            fprintf(stderr, "Erreur: Germe %d (%d,%d) hors limites.\n", i + 1, seeds[i].x, seeds[i].y);
+            return -1;
+        }
+    }
+
+    SRGContext c;
+    c.data = src->data;
+    c.width = w;
+    c.height = h;
+    c.tolerance = tolerance;
+    c.predicate = predicate;
+    LabelImage *labels = label_image_create(w, h);
+    uint8_t *seed_values = malloc(num_seeds);
+    c.sums = calloc(num_seeds, sizeof(long));
+    c.counts = calloc(num_seeds, sizeof(long));
+    c.queue = bucket_queue_create(256);
+    if (!labels || !seed_values || !c.sums || !c.counts || !c.queue) {
+        label_image_free(labels);
+        free(seed_values);
+        free(c.sums);
+        free(c.counts);
+        bucket_queue_free(c.queue);
+        return -1;
+    }
+    c.labels = labels->labels;
+    c.seed_values = seed_values;
+
+    // Germes (un germe déjà pris par une région précédente est ignoré)
+    long labeled = 0;
+    for (int i = 0; i < num_seeds; i++) {
+        int idx = seeds[i].y * w + seeds[i].x;
+        seed_values[i] = src->data[idx];
+        if (c.labels[idx] != 0) continue;
+        _srg_add_pixel(&c, idx, (uint32_t)i + 1);
+        labeled++;
+    }
+    int status = 0;
+    for (int i = 0; i < num_seeds && status == 0; i++) {
+        int idx = seeds[i].y * w + seeds[i].x;
+        if (c.labels[idx] == (uint32_t)i + 1) status = _srg_push_neighbors(&c, idx, (uint32_t)i + 1);
+    }
+
+    // Croissance simultanée : toujours le candidat le plus proche de sa région
+    int idx;
+    while (status == 0 && bucket_queue_pop(c.queue, &idx) >= 0) {
+        int x = idx % w, y = idx / w;
+        uint32_t neighbors[4];
+        int n = 0;
+        if (y > 0) neighbors[n++] = c.labels[idx - w];
+        if (y + 1 < h) neighbors[n++] = c.labels[idx + w];
+        if (x > 0) neighbors[n++] = c.labels[idx - 1];
+        if (x + 1 < w) neighbors[n++] = c.labels[idx + 1];
+
+        // Région voisine la plus proche (la référence a pu changer depuis l'insertion)
+        uint32_t best = 0;
+        int best_diff = tolerance + 1;
+        for (int k = 0; k < n; k++) {
+            uint32_t l = neighbors[k];
+            if (l == 0 || l == SRG_QUEUED) continue;
+            int diff = abs(src->data[idx] - _region_reference(&c, l - 1));
+            if (diff < best_diff) {
+                best_diff = diff;
+                best = l;
+            }
+        }
+        if (best == 0) {
+            // Rejeté pour l'instant : une autre région voisine pourra le reproposer
+            c.labels[idx] = 0;
+            continue;
+        }
+        _srg_add_pixel(&c, idx, best);
+        labeled++;
+        status = _srg_push_neighbors(&c, idx, best);
+    }
+
+    free(seed_values);
+    free(c.sums);
+    free(c.counts);
+    bucket_queue_free(c.queue);
+
+    if (status != 0) {
+        fprintf(stderr, "Erreur: Allocation mémoire impossible pour la croissance de régions.\n");
+        label_image_free(labels);
+        return -1;
+    }
+    *out_labels = labels;
+    return labeled;
+}
+
+int load_region_seeds(const char *path, RegionSeed **out_seeds) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "load_region_seeds: Impossible d'ouvrir '%s'.\n", path);
+        return -1;
+    }
+
+    int count = 0, capacity = 64;
+    RegionSeed *seeds = malloc(capacity * sizeof(RegionSeed));
+    if (!seeds) {
+        fclose(f);
+        return -1;
+    }
+    int x, y;
+    while (fscanf(f, "%d %d", &x, &y) == 2) {
+        if (count == capacity) {
+            capacity *= 2;
+            RegionSeed *grown = realloc(seeds, capacity * sizeof(RegionSeed));
+            if (!grown) {
+                free(seeds);
+                fclose(f);
+                return -1;
+            }
+            seeds = grown;
+        }
+        seeds[count].x = x;
+        seeds[count].y = y;
+        count++;
+    }
+    fclose(f);
+
+    if (count == 0) {
+        fprintf(stderr, "load_region_seeds: Aucun germe \"x y\" dans '%s'.\n", path);
+        free(seeds);
+        return -1;
+    }
+    *out_seeds = seeds;
+    return count;
+}
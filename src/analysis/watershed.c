@@ -0,0 +1,59 @@
+#include "analysis/watershed.h"
+#include "analysis/bucket_queue.h"
+#include <stdio.h>
+
+// Propage l'étiquette du pixel idx à ses voisins libres, placés en file au
+// niveau max(gradient, level)
+static int _flood_neighbors(const uint8_t *g, uint32_t *labels, int w, int h, int idx, int level,
+                            BucketQueue *queue) {
+    int x = idx % w, y = idx / w;
+    int neighbors[4];
+    int n = 0;
+    if (y > 0) neighbors[n++] = idx - w;
+    if (y + 1 < h) neighbors[n++] = idx + w;
+    if (x > 0) neighbors[n++] = idx - 1;
+    if (x + 1 < w) neighbors[n++] = idx + 1;
+
+    for (int k = 0; k < n; k++) {
+        int nidx = neighbors[k];
+        if (labels[nidx] != 0) continue;
+        labels[nidx] = labels[idx];
+        int priority = g[nidx] > level ? g[nidx] : level;
+        if (bucket_queue_push(queue, priority, nidx) != 0) return -1;
+    }
+    return 0;
+}
+
+int watershed(const Image *gradient, LabelImage *markers) {
+    if (!gradient || !gradient->data || gradient->channels != 1 || !markers || !markers->labels ||
+        markers->width != gradient->width || markers->height != gradient->height) {
+        fprintf(stderr, "watershed: Arguments invalides.\n");
+        return -1;
+    }
+    int w = gradient->width;
+    int h = gradient->height;
+    const uint8_t *g = gradient->data;
+    uint32_t *labels = markers->labels;
+
+    BucketQueue *queue = bucket_queue_create(256);
+    if (!queue) return -1;
+
+    // Les marqueurs entrent en file au niveau 0 : ils sont traités avant tout autre pixel
+    int status = 0;
+    for (int idx = 0; idx < w * h && status == 0; idx++) {
+        if (labels[idx] != 0) status = bucket_queue_push(queue, 0, idx);
+    }
+
+    // Inondation, du niveau le plus bas au plus haut
+    int idx, level;
+    while (status == 0 && (level = bucket_queue_pop(queue, &idx)) >= 0) {
+        status = _flood_neighbors(g, labels, w, h, idx, level, queue);
+    }
+
+    bucket_queue_free(queue);
+    if (status != 0) {
+        fprintf(stderr, "watershed: Allocation mémoire impossible.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "cli/parser.h"
+#include "analysis/histogram.h" // MULTI_OTSU_MAX_THRESHOLDS
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -13,6 +14,8 @@ Arguments parse_args(int argc, char *argv[]) {
     args.saturated_max = -1;
     args.blur_kernel_size = 0;
     args.gaussian_blur_kernel_size = 0;
+    args.gaussian_sigma = 0.0;
+    args.kernel_path = NULL;
     args.apply_sobel = false;
     args.apply_sharpen = false;
     args.apply_equalization = false;
@@ -21,6 +24,8 @@ Arguments parse_args(int argc, char *argv[]) {
     args.fft_spectrum_path = NULL;
     args.fft_lowpass_radius = 0; 
     args.fft_highpass_radius = 0;
+    args.fft_float = false;
+    args.fft_tile_size = 0;
     args.apply_prewitt = false;
     args.apply_roberts = false;
     args.threshold_value = -1;
@@ -30,6 +35,10 @@ Arguments parse_args(int argc, char *argv[]) {
     args.second_image_path = NULL;
     args.resize_height = 0;
     args.resize_bilinear = false;
+    args.resize_area = false;
+    args.resize_bicubic = false;
+    args.resize_lanczos = false;
+    args.pyramid_levels = 0;
     args.local_eq_window = 0;
     args.apply_invert = false;
     args.apply_and = false;
@@ -38,14 +47,34 @@ Arguments parse_args(int argc, char *argv[]) {
     args.min_kernel_size = 0;
     args.max_kernel_size = 0;
     args.rotation_angle = 0.0;
+    args.rotate_bilinear = false;
+    args.rotate_expand = false;
+    args.rotate_shear = false;
+    args.warp_matrix_size = 0;
     args.fft_emphasis_radius = 0;
     args.fft_emphasis_low = 1.0;
     args.fft_emphasis_high = 1.0;
     args.hough_threshold = 0;
+    args.hough_gradient_tolerance = 0.0;
+    args.hough_p_threshold = 0;
+    args.hough_p_min_length = 0;
+    args.hough_p_max_gap = 0;
+    args.hough_circle_min_radius = 0;
+    args.hough_circle_max_radius = 0;
     args.use_otsu = false;
+    args.otsu_levels = 0;
+    args.adaptive_method = NULL;
+    args.adaptive_window = 0;
+    args.adaptive_k = 0.0;
     args.region_tolerance = -1;
     args.seed_x = 0;
     args.seed_y = 0;
+    args.region_seeds_path = NULL;
+    args.region_seeds_tolerance = 0;
+    args.region_mean = false;
+    args.watershed_seeds_path = NULL;
+    args.label_connectivity = 0;
+    args.num_threads = 0;
 
     // 2. Boucle sur tous les arguments de la ligne de commande (sauf le nom du programme)
     for (int i = 1; i < argc; i++) {
@@ -123,6 +152,22 @@ Arguments parse_args(int argc, char *argv[]) {
                 exit(1);
             }
         }
+        else if (strcmp(argv[i], "--gaussian-sigma") == 0) {
+            if (i + 1 < argc) {
+                args.gaussian_sigma = atof(argv[++i]);
+            } else {
+                fprintf(stderr, "Erreur: L'option --gaussian-sigma nécessite un écart-type (ex: 10).\n");
+                exit(1);
+            }
+        }
+        else if (strcmp(argv[i], "--kernel") == 0) {
+            if (i + 1 < argc) {
+                args.kernel_path = argv[++i];
+            } else {
+                fprintf(stderr, "Erreur: L'option --kernel nécessite un fichier de noyau.\n");
+                exit(1);
+            }
+        }
         else if (strcmp(argv[i], "--sobel") == 0) {
             args.apply_sobel = true;
         }
@@ -173,6 +218,17 @@ Arguments parse_args(int argc, char *argv[]) {
                 exit(1);
             }
         }
+        else if (strcmp(argv[i], "--fft-float") == 0) {
+            args.fft_float = true;
+        }
+        else if (strcmp(argv[i], "--fft-tile") == 0) {
+            if (i + 1 < argc) {
+                args.fft_tile_size = atoi(argv[++i]);
+            } else {
+                fprintf(stderr, "Erreur: L'option --fft-tile nécessite une taille de bloc (ex: 512).\n");
+                exit(1);
+            }
+        }
         else if (strcmp(argv[i], "--prewitt") == 0) {
             args.apply_prewitt = true;
         }
@@ -223,6 +279,19 @@ Arguments parse_args(int argc, char *argv[]) {
         else if (strcmp(argv[i], "--bilinear") == 0) {
             args.resize_bilinear = true; // S'utilise en combinaison avec --resize
         }
+        else if (strcmp(argv[i], "--area") == 0) {
+            args.resize_area = true; // S'utilise en combinaison avec --resize
+        }
+        else if (strcmp(argv[i], "--bicubic") == 0) {
+            args.resize_bicubic = true; // S'utilise en combinaison avec --resize
+        }
+        else if (strcmp(argv[i], "--lanczos") == 0) {
+            args.resize_lanczos = true; // S'utilise en combinaison avec --resize
+        }
+        else if (strcmp(argv[i], "--pyramid") == 0) {
+            if (i + 1 < argc) args.pyramid_levels = atoi(argv[++i]);
+            else { fprintf(stderr, "Erreur: --pyramid attend un nombre de niveaux (ex: 4).\n"); exit(1); }
+        }
         else if (strcmp(argv[i], "--equalize-local") == 0) {
             if (i + 1 < argc) args.local_eq_window = atoi(argv[++i]);
             else { fprintf(stderr, "Erreur: --equalize-local attend une taille de fenêtre.\n"); exit(1); }
@@ -255,6 +324,25 @@ Arguments parse_args(int argc, char *argv[]) {
         else if (strcmp(argv[i], "--rotate") == 0) {
             if (i + 1 < argc) args.rotation_angle = atof(argv[++i]);
         }
+        else if (strcmp(argv[i], "--rotate-bilinear") == 0) {
+            args.rotate_bilinear = true; // S'utilise en combinaison avec --rotate
+        }
+        else if (strcmp(argv[i], "--rotate-expand") == 0) {
+            args.rotate_expand = true; // S'utilise en combinaison avec --rotate
+        }
+        else if (strcmp(argv[i], "--rotate-shear") == 0) {
+            args.rotate_shear = true; // S'utilise en combinaison avec --rotate
+        }
+        else if (strcmp(argv[i], "--warp-affine") == 0 || strcmp(argv[i], "--warp-perspective") == 0) {
+            int size = strcmp(argv[i], "--warp-affine") == 0 ? 6 : 9;
+            if (i + size < argc) {
+                args.warp_matrix_size = size;
+                for (int k = 0; k < size; k++) args.warp_matrix[k] = atof(argv[++i]);
+            } else {
+                fprintf(stderr, "Erreur: %s attend %d coefficients (matrice ligne par ligne).\n", argv[i], size);
+                exit(1);
+            }
+        }
         else if (strcmp(argv[i], "--fft-emphasis") == 0) {
             if (i + 3 < argc) {
                 args.fft_emphasis_radius = atoi(argv[++i]);
@@ -272,9 +360,51 @@ Arguments parse_args(int argc, char *argv[]) {
             if (i + 1 < argc) args.hough_threshold = atoi(argv[++i]);
             else { fprintf(stderr, "Erreur: --hough attend un seuil (ex: 100).\n"); exit(1); }
         }
+        else if (strcmp(argv[i], "--hough-gradient") == 0) {
+            if (i + 1 < argc) args.hough_gradient_tolerance = atof(argv[++i]);
+            else { fprintf(stderr, "Erreur: --hough-gradient attend une tolérance en degrés (ex: 10).\n"); exit(1); }
+        }
+        else if (strcmp(argv[i], "--hough-p") == 0) {
+            if (i + 3 < argc) {
+                args.hough_p_threshold = atoi(argv[++i]);
+                args.hough_p_min_length = atoi(argv[++i]);
+                args.hough_p_max_gap = atoi(argv[++i]);
+            } else {
+                fprintf(stderr, "Erreur: --hough-p attend un seuil, une longueur minimale et un écart maximal (ex: 50 30 5).\n");
+                exit(1);
+            }
+        }
+        else if (strcmp(argv[i], "--hough-circles") == 0) {
+            if (i + 2 < argc) {
+                args.hough_circle_min_radius = atoi(argv[++i]);
+                args.hough_circle_max_radius = atoi(argv[++i]);
+            } else {
+                fprintf(stderr, "Erreur: --hough-circles attend un rayon minimal et un rayon maximal (ex: 10 40).\n");
+                exit(1);
+            }
+        }
         else if (strcmp(argv[i], "--otsu") == 0) {
             args.use_otsu = true;
         }
+        else if (strcmp(argv[i], "--adaptive") == 0) {
+            if (i + 3 < argc) {
+                args.adaptive_method = argv[++i];
+                args.adaptive_window = atoi(argv[++i]);
+                args.adaptive_k = atof(argv[++i]);
+            }
+            if (!args.adaptive_method || (strcmp(args.adaptive_method, "bradley") != 0 &&
+                                          strcmp(args.adaptive_method, "sauvola") != 0)) {
+                fprintf(stderr, "Erreur: --adaptive attend <bradley|sauvola> <fenetre> <k> (ex: sauvola 31 0.34).\n");
+                exit(1);
+            }
+        }
+        else if (strcmp(argv[i], "--otsu-levels") == 0) {
+            if (i + 1 < argc) args.otsu_levels = atoi(argv[++i]);
+            if (args.otsu_levels < 1 || args.otsu_levels > MULTI_OTSU_MAX_THRESHOLDS) {
+                fprintf(stderr, "Erreur: --otsu-levels attend un nombre de seuils entre 1 et %d.\n", MULTI_OTSU_MAX_THRESHOLDS);
+                exit(1);
+            }
+        }
         else if (strcmp(argv[i], "--region-growing") == 0) {
             if (i + 3 < argc) {
                 args.seed_x = atoi(argv[++i]);
@@ -285,6 +415,29 @@ Arguments parse_args(int argc, char *argv[]) {
                 exit(1);
             }
         }
+        else if (strcmp(argv[i], "--region-seeds") == 0) {
+            if (i + 2 < argc) {
+                args.region_seeds_path = argv[++i];
+                args.region_seeds_tolerance = atoi(argv[++i]);
+            } else {
+                fprintf(stderr, "Erreur: --region-seeds attend <fichier> <tolerance>\n");
+                exit(1);
+            }
+        }
+        else if (strcmp(argv[i], "--region-mean") == 0) {
+            args.region_mean = true;
+        }
+        else if (strcmp(argv[i], "--watershed") == 0) {
+            if (i + 1 < argc) args.watershed_seeds_path = argv[++i];
+            else { fprintf(stderr, "Erreur: --watershed attend un fichier de marqueurs.\n"); exit(1); }
+        }
+        else if (strcmp(argv[i], "--label") == 0) {
+            if (i + 1 < argc) args.label_connectivity = atoi(argv[++i]);
+            if (args.label_connectivity != 4 && args.label_connectivity != 8) {
+                fprintf(stderr, "Erreur: --label attend une connexité 4 ou 8.\n");
+                exit(1);
+            }
+        }
         else if (strcmp(argv[i], "--opening") == 0) {
             if (i + 1 < argc) args.morph_open_size = atoi(argv[++i]);
         }
@@ -300,6 +453,10 @@ Arguments parse_args(int argc, char *argv[]) {
         else if (strcmp(argv[i], "--dilate") == 0) {
             if (i + 1 < argc) args.morph_dilate_size = atoi(argv[++i]);
         }
+        else if (strcmp(argv[i], "--threads") == 0) {
+            if (i + 1 < argc) args.num_threads = atoi(argv[++i]);
+            else { fprintf(stderr, "Erreur: --threads attend un nombre de threads.\n"); exit(1); }
+        }
 
 
 
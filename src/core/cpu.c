@@ -0,0 +1,39 @@
+#include "core/cpu.h"
+#include <stdlib.h>
+#include <string.h>
+
+static SimdLevel detect_simd_level(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    SimdLevel level = SIMD_NONE;
+    __builtin_cpu_init();
+#ifdef __SSE2__
+    level = SIMD_SSE2;
+#endif
+    if (__builtin_cpu_supports("avx2")) {
+        level = SIMD_AVX2;
+    }
+#else
+    SimdLevel level = SIMD_NONE;
+#endif
+
+    // Plafond optionnel imposé par l'utilisateur
+    const char *env = getenv("IMGPROC_SIMD");
+    if (env) {
+        SimdLevel cap = level;
+        if (strcmp(env, "none") == 0) cap = SIMD_NONE;
+        else if (strcmp(env, "sse2") == 0) cap = SIMD_SSE2;
+        else if (strcmp(env, "avx2") == 0) cap = SIMD_AVX2;
+        if (cap < level) level = cap;
+    }
+    return level;
+}
+
+SimdLevel cpu_simd_level(void) {
+    static int detected = 0;
+    static SimdLevel level = SIMD_NONE;
+    if (!detected) {
+        level = detect_simd_level();
+        detected = 1;
+    }
+    return level;
+}
@@ -0,0 +1,154 @@
+#include "core/parallel.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#define PARALLEL_MAX_THREADS 64
+
+// Pool de threads persistant : les workers attendent un "travail" (une boucle
+// découpée en morceaux), chacun traite le morceau correspondant à son numéro.
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;   // Signale un nouveau travail aux workers
+    pthread_cond_t done_cond;   // Signale la fin du dernier morceau
+    pthread_t workers[PARALLEL_MAX_THREADS];
+    unsigned long start_generation[PARALLEL_MAX_THREADS]; // Génération vue à la création
+    int num_workers;            // Workers déjà créés (hors thread appelant)
+    unsigned long generation;   // Incrémenté à chaque nouveau travail
+    ParallelRangeFn fn;
+    void *ctx;
+    int count;
+    int num_chunks;
+    int pending;                // Morceaux restant à terminer
+} pool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work_cond = PTHREAD_COND_INITIALIZER,
+    .done_cond = PTHREAD_COND_INITIALIZER,
+};
+
+// Un seul parallel_for à la fois utilise le pool.
+static pthread_mutex_t submit_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Vrai dans les threads du pool : les appels imbriqués s'exécutent en séquentiel.
+static __thread int in_worker = 0;
+
+static int configured_threads = 0; // 0 = pas encore initialisé
+
+static void run_chunk(ParallelRangeFn fn, void *ctx, int count, int num_chunks, int chunk) {
+    int begin = (int)((long)count * chunk / num_chunks);
+    int end = (int)((long)count * (chunk + 1) / num_chunks);
+    if (begin < end) {
+        fn(ctx, begin, end, chunk);
+    }
+}
+
+static void *worker_main(void *arg) {
+    int chunk = (int)(long)arg; // Le worker i traite le morceau i (le 0 est pour l'appelant)
+    unsigned long seen = 0;
+    in_worker = 1;
+
+    pthread_mutex_lock(&pool.lock);
+    seen = pool.start_generation[chunk - 1];
+    for (;;) {
+        while (pool.generation == seen) {
+            pthread_cond_wait(&pool.work_cond, &pool.lock);
+        }
+        seen = pool.generation;
+
+        if (chunk < pool.num_chunks) {
+            ParallelRangeFn fn = pool.fn;
+            void *ctx = pool.ctx;
+            int count = pool.count;
+            int num_chunks = pool.num_chunks;
+            pthread_mutex_unlock(&pool.lock);
+
+            run_chunk(fn, ctx, count, num_chunks, chunk);
+
+            pthread_mutex_lock(&pool.lock);
+            if (--pool.pending == 0) {
+                pthread_cond_signal(&pool.done_cond);
+            }
+        }
+    }
+    return NULL;
+}
+
+void parallel_set_num_threads(int num_threads) {
+    if (num_threads < 1) num_threads = 1;
+    if (num_threads > PARALLEL_MAX_THREADS) num_threads = PARALLEL_MAX_THREADS;
+    configured_threads = num_threads;
+}
+
+int parallel_get_num_threads(void) {
+    if (configured_threads == 0) {
+        int n = 0;
+        const char *env = getenv("IMGPROC_THREADS");
+        if (env) n = atoi(env);
+        if (n <= 0) n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        parallel_set_num_threads(n);
+    }
+    return configured_threads;
+}
+
+int parallel_thread_count(int count, int min_chunk) {
+    if (in_worker) return 1;
+    if (min_chunk < 1) min_chunk = 1;
+
+    int n = parallel_get_num_threads();
+    int max_useful = count / min_chunk;
+    if (n > max_useful) n = max_useful;
+    return n < 1 ? 1 : n;
+}
+
+void parallel_for(int count, int num_chunks, ParallelRangeFn fn, void *ctx) {
+    if (count <= 0) return;
+    if (num_chunks < 1) num_chunks = 1;
+    if (num_chunks > PARALLEL_MAX_THREADS) num_chunks = PARALLEL_MAX_THREADS;
+
+    // Séquentiel : un seul morceau, appel imbriqué, ou pool déjà occupé par un autre thread.
+    // Les morceaux gardent leur numéro pour que les buffers par thread restent valides.
+    if (num_chunks == 1 || in_worker || pthread_mutex_trylock(&submit_lock) != 0) {
+        for (int chunk = 0; chunk < num_chunks; chunk++) {
+            run_chunk(fn, ctx, count, num_chunks, chunk);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+
+    // Créer les workers manquants (le pool ne fait que grandir)
+    while (pool.num_workers < num_chunks - 1) {
+        long chunk = pool.num_workers + 1;
+        pool.start_generation[pool.num_workers] = pool.generation;
+        if (pthread_create(&pool.workers[pool.num_workers], NULL, worker_main, (void *)chunk) != 0) {
+            break;
+        }
+        pthread_detach(pool.workers[pool.num_workers]);
+        pool.num_workers++;
+    }
+    // Si la création d'un thread a échoué, on se contente des workers existants
+    pool.num_chunks = num_chunks <= pool.num_workers + 1 ? num_chunks : pool.num_workers + 1;
+
+    pool.fn = fn;
+    pool.ctx = ctx;
+    pool.count = count;
+    pool.pending = pool.num_chunks - 1;
+    int chunks = pool.num_chunks;
+    pool.generation++;
+    pthread_cond_broadcast(&pool.work_cond);
+    pthread_mutex_unlock(&pool.lock);
+
+    // Le thread appelant traite le morceau 0 (en mode "worker" pour l'imbrication)
+    in_worker = 1;
+    run_chunk(fn, ctx, count, chunks, 0);
+    in_worker = 0;
+
+    pthread_mutex_lock(&pool.lock);
+    while (pool.pending > 0) {
+        pthread_cond_wait(&pool.done_cond, &pool.lock);
+    }
+    pthread_mutex_unlock(&pool.lock);
+
+    pthread_mutex_unlock(&submit_lock);
+}
@@ -3,20 +3,14 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "fft/fft.h"
+#include "fft/fft_f32.h"
+#include "fft/freq_filter.h"
+#include "core/parallel.h"
 #include <string.h>
 
 
 
 
-// Ajouter cette fonction de comparaison pour qsort (si pas déjà dans ce fichier)
-static int compare_doubles(const void *a, const void *b) {
-    double val1 = *(const double *)a;
-    double val2 = *(const double *)b;
-    if (val1 < val2) return -1;
-    if (val1 > val2) return 1;
-    return 0;
-}
-
 // --- Partie 1 : Implémentation de la FFT 1D (Algorithme de Cooley-Tukey) ---
 
 // Fonction interne récursive pour la FFT 1D.
@@ -80,6 +74,97 @@ static int next_power_of_2(int n) {
     return power;
 }
 
+int fft_padded_size(int n) {
+    return next_power_of_2(n);
+}
+
+// --- Transformée 2D parallèle ---
+// Les FFT 1D des lignes (puis des colonnes) sont indépendantes : on répartit
+// des paquets de lignes/colonnes sur le pool de threads. Chaque transformée 1D
+// est calculée exactement comme en séquentiel, le résultat est donc identique
+// quel que soit le nombre de threads.
+
+// Nombre de colonnes copiées ensemble dans le buffer de travail : chaque ligne
+// de la matrice est lue sur COLUMN_BATCH éléments contigus au lieu d'un seul.
+#define COLUMN_BATCH 8
+
+typedef struct {
+    Complex **data;
+    int width;
+    int height;
+    int inverse;
+    Complex **scratch; // Un buffer de colonnes par thread
+} FFT2DContext;
+
+static void _fft_rows_worker(void *arg, int begin, int end, int thread_id) {
+    FFT2DContext *ctx = (FFT2DContext *)arg;
+    (void)thread_id;
+    for (int y = begin; y < end; y++) {
+        if (ctx->inverse) _ifft1d(ctx->data[y], ctx->width);
+        else _fft1d(ctx->data[y], ctx->width);
+    }
+}
+
+static void _fft_columns_worker(void *arg, int begin, int end, int thread_id) {
+    FFT2DContext *ctx = (FFT2DContext *)arg;
+    Complex *columns = ctx->scratch[thread_id];
+    int height = ctx->height;
+
+    // begin/end sont des indices de paquets de colonnes
+    for (int batch = begin; batch < end; batch++) {
+        int x0 = batch * COLUMN_BATCH;
+        int count = ctx->width - x0 < COLUMN_BATCH ? ctx->width - x0 : COLUMN_BATCH;
+
+        // 1. Copier le paquet de colonnes (transposition partielle)
+        for (int y = 0; y < height; y++) {
+            const Complex *row = ctx->data[y] + x0;
+            for (int b = 0; b < count; b++) {
+                columns[b * height + y] = row[b];
+            }
+        }
+        // 2. FFT de chaque colonne
+        for (int b = 0; b < count; b++) {
+            if (ctx->inverse) _ifft1d(columns + b * height, height);
+            else _fft1d(columns + b * height, height);
+        }
+        // 3. Recopier dans la matrice
+        for (int y = 0; y < height; y++) {
+            Complex *row = ctx->data[y] + x0;
+            for (int b = 0; b < count; b++) {
+                row[b] = columns[b * height + y];
+            }
+        }
+    }
+}
+
+// Applique la FFT (ou l'IFFT) 2D en place : lignes puis colonnes.
+static int _fft2d_inplace(Complex **data, int width, int height, int inverse) {
+    FFT2DContext ctx = {data, width, height, inverse, NULL};
+
+    // FFT sur les lignes
+    int threads = parallel_thread_count(height, 4);
+    parallel_for(height, threads, _fft_rows_worker, &ctx);
+
+    // FFT sur les colonnes, par paquets, avec un buffer de travail par thread
+    int batches = (width + COLUMN_BATCH - 1) / COLUMN_BATCH;
+    threads = parallel_thread_count(batches, 1);
+    ctx.scratch = malloc(threads * sizeof(Complex *));
+    if (!ctx.scratch) return -1;
+    for (int t = 0; t < threads; t++) {
+        ctx.scratch[t] = malloc((size_t)COLUMN_BATCH * height * sizeof(Complex));
+        if (!ctx.scratch[t]) {
+            for (int i = 0; i < t; i++) free(ctx.scratch[i]);
+            free(ctx.scratch);
+            return -1;
+        }
+    }
+    parallel_for(batches, threads, _fft_columns_worker, &ctx);
+
+    for (int t = 0; t < threads; t++) free(ctx.scratch[t]);
+    free(ctx.scratch);
+    return 0;
+}
+
 Complex **fft2d(const Image *src, int *out_width, int *out_height) {
     if (!src || !src->data || src->channels != 1) {
         fprintf(stderr, "fft2d: Image invalide ou non supportée.\n");
@@ -94,8 +179,13 @@ Complex **fft2d(const Image *src, int *out_width, int *out_height) {
 
     // Allocation de la matrice 2D de nombres complexes
     Complex **data = malloc(height * sizeof(Complex *));
+    if (!data) return NULL;
     for (int i = 0; i < height; i++) {
         data[i] = calloc(width, sizeof(Complex)); // calloc initialise à 0
+        if (!data[i]) {
+            free_fft_data(data, i);
+            return NULL;
+        }
     }
 
     // Copier les données de l'image dans la partie réelle de la matrice
@@ -105,50 +195,22 @@ Complex **fft2d(const Image *src, int *out_width, int *out_height) {
         }
     }
 
-    // FFT sur les lignes
-    for (int y = 0; y < height; y++) {
-        _fft1d(data[y], width);
-    }
-    
-    // Transposition et FFT sur les colonnes (plus efficace pour le cache)
-    // 1. Allouer un buffer temporaire pour une colonne
-    Complex *column = malloc(height * sizeof(Complex));
-    // 2. Appliquer la FFT colonne par colonne
-    for (int x = 0; x < width; x++) {
-        for (int y = 0; y < height; y++) {
-            column[y] = data[y][x];
-        }
-        _fft1d(column, height);
-        for (int y = 0; y < height; y++) {
-            data[y][x] = column[y];
-        }
+    if (_fft2d_inplace(data, width, height, 0) != 0) {
+        free_fft_data(data, height);
+        return NULL;
     }
-    free(column);
 
     return data;
 }
 
 Image *ifft2d(Complex **fft_data, int width, int height) {
-    // IFFT sur les lignes
-    for (int y = 0; y < height; y++) {
-        _ifft1d(fft_data[y], width);
-    }
-    
-    // Transposition et IFFT sur les colonnes
-    Complex *column = malloc(height * sizeof(Complex));
-    for (int x = 0; x < width; x++) {
-        for (int y = 0; y < height; y++) {
-            column[y] = fft_data[y][x];
-        }
-        _ifft1d(column, height);
-        for (int y = 0; y < height; y++) {
-            fft_data[y][x] = column[y];
-        }
+    if (_fft2d_inplace(fft_data, width, height, 1) != 0) {
+        return NULL;
     }
-    free(column);
 
     // Créer l'image de sortie et copier la partie réelle
     Image *dest = createImage(width, height, 1);
+    if (!dest) return NULL;
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
             double val = fft_data[y][x].real;
@@ -160,6 +222,118 @@ Image *ifft2d(Complex **fft_data, int width, int height) {
     return dest;
 }
 
+// --- Chemin simple précision (SoA + SIMD, voir fft_f32.c) ---
+
+static Complex **_alloc_fft_data(int width, int height) {
+    Complex **data = malloc(height * sizeof(Complex *));
+    if (!data) return NULL;
+    for (int i = 0; i < height; i++) {
+        data[i] = malloc(width * sizeof(Complex));
+        if (!data[i]) {
+            free_fft_data(data, i);
+            return NULL;
+        }
+    }
+    return data;
+}
+
+SplitComplexPlane *fft2d_f32_image(const Image *src) {
+    if (!src || !src->data || src->channels != 1) {
+        fprintf(stderr, "fft2d_f32_image: Image invalide ou non supportée.\n");
+        return NULL;
+    }
+
+    int width = next_power_of_2(src->width);
+    int height = next_power_of_2(src->height);
+
+    // Image -> parties réelles (le reste est déjà à zéro : padding)
+    SplitComplexPlane *plane = split_plane_create(width, height);
+    if (!plane) return NULL;
+    for (int y = 0; y < src->height; y++) {
+        for (int x = 0; x < src->width; x++) {
+            plane->re[(size_t)y * width + x] = src->data[y * src->width + x];
+        }
+    }
+
+    if (fft2d_f32_inplace(plane, 0) != 0) {
+        split_plane_free(plane);
+        return NULL;
+    }
+    return plane;
+}
+
+Image *ifft2d_f32_image(SplitComplexPlane *plane) {
+    if (!plane) return NULL;
+    if (fft2d_f32_inplace(plane, 1) != 0) return NULL;
+
+    // Normalisation par N (l'inverse SoA n'est pas normalisée) et écrêtage.
+    // L'erreur d'arrondi float (< 2e-4 niveau) ferait tomber un 99.9999 à 99
+    // lors de la troncature : on ajoute une petite marge avant de tronquer.
+    int width = plane->width;
+    int height = plane->height;
+    Image *dest = createImage(width, height, 1);
+    if (dest) {
+        double scale = 1.0 / ((double)width * height);
+        for (size_t i = 0; i < (size_t)width * height; i++) {
+            double val = plane->re[i] * scale + FLOAT_TRUNCATION_GUARD;
+            if (val < 0) val = 0;
+            if (val > 255) val = 255;
+            dest->data[i] = (uint8_t)val;
+        }
+    }
+    return dest;
+}
+
+// Couche de compatibilité : spectre float recopié dans une matrice de Complex
+Complex **fft2d_ex(const Image *src, int *out_width, int *out_height, FFTPrecision precision) {
+    if (precision == FFT_PRECISION_DOUBLE) {
+        return fft2d(src, out_width, out_height);
+    }
+
+    SplitComplexPlane *plane = fft2d_f32_image(src);
+    if (!plane) return NULL;
+
+    int width = plane->width;
+    int height = plane->height;
+    Complex **data = _alloc_fft_data(width, height);
+    if (data) {
+        for (int y = 0; y < height; y++) {
+            const float *re = plane->re + (size_t)y * width;
+            const float *im = plane->im + (size_t)y * width;
+            for (int x = 0; x < width; x++) {
+                data[y][x].real = re[x];
+                data[y][x].imag = im[x];
+            }
+        }
+        *out_width = width;
+        *out_height = height;
+    }
+
+    split_plane_free(plane);
+    return data;
+}
+
+Image *ifft2d_ex(Complex **fft_data, int width, int height, FFTPrecision precision) {
+    if (precision == FFT_PRECISION_DOUBLE) {
+        return ifft2d(fft_data, width, height);
+    }
+
+    SplitComplexPlane *plane = split_plane_create(width, height);
+    if (!plane) return NULL;
+    for (int y = 0; y < height; y++) {
+        float *re = plane->re + (size_t)y * width;
+        float *im = plane->im + (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            re[x] = (float)fft_data[y][x].real;
+            im[x] = (float)fft_data[y][x].imag;
+        }
+    }
+
+    Image *dest = ifft2d_f32_image(plane);
+    split_plane_free(plane);
+    return dest;
+}
+
 void free_fft_data(Complex **data, int height) {
     if (data) {
         for (int i = 0; i < height; i++) {
@@ -263,118 +437,52 @@ void fft_highpass_filter(Complex **fft_data, int width, int height, int radius)
 
 // Fonction pour appliquer UN filtre notch (et son symétrique)
 void fft_notch_filter(Complex **fft_data, int width, int height, int u, int v, int radius) {
-    double radius_squared = (double)radius * radius;
     int center_x = width / 2;
     int center_y = height / 2;
+    if (radius < 0) radius = -radius;
+    double radius_squared = (double)radius * radius;
 
     // Coordonnées du bruit (u,v) et de son symétrique (-u,-v) par rapport au centre
-    int u1 = u;
-    int v1 = v;
-    int u2 = -u;
-    int v2 = -v;
-
-    for (int y_shifted = 0; y_shifted < height; y_shifted++) {
-        for (int x_shifted = 0; x_shifted < width; x_shifted++) {
-            // Coordonnées par rapport au centre du spectre
-            int current_u = x_shifted - center_x;
-            int current_v = y_shifted - center_y;
-            
-            // Calcul des distances aux deux points de bruit
-            double d1_sq = pow(current_u - u1, 2) + pow(current_v - v1, 2);
-            double d2_sq = pow(current_u - u2, 2) + pow(current_v - v2, 2);
-
-            if (d1_sq <= radius_squared || d2_sq <= radius_squared) {
-                // Traduire les coordonnées décalées en coordonnées de la matrice réelle
-                int y_actual = (y_shifted + center_y) % height;
-                int x_actual = (x_shifted + center_x) % width;
-                
-                fft_data[y_actual][x_actual].real = 0;
-                fft_data[y_actual][x_actual].imag = 0;
+    int centers_u[2] = {u, -u};
+    int centers_v[2] = {v, -v};
+
+    for (int c = 0; c < 2; c++) {
+        // On ne parcourt que la boîte englobante du disque, limitée au spectre centré
+        int u0 = centers_u[c] - radius, u1 = centers_u[c] + radius;
+        int v0 = centers_v[c] - radius, v1 = centers_v[c] + radius;
+        if (u0 < -center_x) u0 = -center_x;
+        if (u1 > width - 1 - center_x) u1 = width - 1 - center_x;
+        if (v0 < -center_y) v0 = -center_y;
+        if (v1 > height - 1 - center_y) v1 = height - 1 - center_y;
+
+        for (int current_v = v0; current_v <= v1; current_v++) {
+            int dv = current_v - centers_v[c];
+            // Traduire les coordonnées centrées en coordonnées de la matrice réelle
+            int y_actual = (current_v + 2 * center_y) % height;
+            for (int current_u = u0; current_u <= u1; current_u++) {
+                int du = current_u - centers_u[c];
+                if ((double)(du * du + dv * dv) <= radius_squared) {
+                    int x_actual = (current_u + 2 * center_x) % width;
+                    fft_data[y_actual][x_actual].real = 0;
+                    fft_data[y_actual][x_actual].imag = 0;
+                }
             }
         }
     }
 }
 
-
-// Ajouter la nouvelle fonction à la fin de fft.c
 int fft_auto_notch_filter(Complex **fft_data, int width, int height, double threshold_factor, int radius) {
-    long total_pixels = (long)width * height;
-    double *magnitudes = malloc(total_pixels * sizeof(double));
-    if (!magnitudes) return 0;
-
-    int center_x = width / 2;
-    int center_y = height / 2;
-
-    // 1. Calculer le spectre de magnitude (non logarithmique, non décalé)
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            magnitudes[y * width + x] = complex_magnitude(fft_data[y][x]);
-        }
-    }
-    
-    // 2. Trouver une valeur de seuil robuste basée sur la médiane
-    // La médiane est moins sensible aux valeurs extrêmes (les pics) que la moyenne.
-    double *sorted_magnitudes = malloc(total_pixels * sizeof(double));
-    if (!sorted_magnitudes) {
-        free(magnitudes);
-        return 0;
-    }
-    memcpy(sorted_magnitudes, magnitudes, total_pixels * sizeof(double));
-    qsort(sorted_magnitudes, total_pixels, sizeof(double), compare_doubles);
-    
-    double median_magnitude = sorted_magnitudes[total_pixels / 2];
-    double noise_threshold = median_magnitude * threshold_factor;
-
-    free(sorted_magnitudes); // Plus besoin de la version triée
-
-    printf("Détection auto: Médiane=%.2f, Seuil de bruit=%.2f\n", median_magnitude, noise_threshold);
-    
-    int detected_peaks_count = 0;
-    NotchFilter detected_notches[20]; // Stocker les pics trouvés
-
-    // 3. Détecter les pics qui dépassent le seuil
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            // Ignorer la zone centrale (basses fréquences)
-            int dx = x < center_x ? x : width - x;
-            int dy = y < center_y ? y : height - y;
-            // On ignore un rayon de 5% autour du centre pour ne pas toucher à l'image
-            if (sqrt(dx*dx + dy*dy) < (width * 0.05)) {
-                continue;
-            }
+    // Détection des pics puis application de tous les notch en une seule passe
+    FreqFilter *filter = freq_filter_create(width, height);
+    if (!filter) return 0;
 
-            if (magnitudes[y * width + x] > noise_threshold) {
-                if (detected_peaks_count < 20) {
-                    // Convertir les coordonnées de la matrice en coordonnées relatives au centre
-                    int u = (x + center_x) % width - center_x;
-                    int v = (y + center_y) % height - center_y;
-                    
-                    // Ajouter le pic à notre liste
-                    detected_notches[detected_peaks_count].u = u;
-                    detected_notches[detected_peaks_count].v = v;
-                    detected_notches[detected_peaks_count].radius = radius;
-                    detected_peaks_count++;
-                }
-            }
-        }
-    }
-    
-    free(magnitudes);
-
-    // 4. Appliquer les filtres notch pour chaque pic détecté
-    if (detected_peaks_count > 0) {
-        printf("%d pic(s) de bruit détecté(s). Application des filtres...\n", detected_peaks_count);
-        // On applique le filtre pour chaque pic. La symétrie est déjà gérée dans fft_notch_filter.
-        // On ne parcourt que la moitié des pics, car chaque appel traite une paire symétrique.
-        for (int i = 0; i < detected_peaks_count; i++) {
-             NotchFilter n = detected_notches[i];
-             printf("  - Suppression du bruit autour de (%d, %d)\n", n.u, n.v);
-             fft_notch_filter(fft_data, width, height, n.u, n.v, n.radius);
-        }
+    int pairs = freq_filter_add_auto_notches(filter, fft_data, threshold_factor, radius);
+    if (pairs < 0 || (filter->notch_count > 0 && freq_filter_apply(filter, fft_data) != 0)) {
+        pairs = 0;
     }
 
-    // On retourne le nombre de paires (un pic et son symétrique)
-    return detected_peaks_count / 2;
+    freq_filter_free(filter);
+    return pairs;
 }
 
 void fft_emphasis_filter(Complex **fft_data, int width, int height, int radius, double k_low, double k_high) {
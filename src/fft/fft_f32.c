@@ -0,0 +1,389 @@
+#define _USE_MATH_DEFINES
+#include "fft/fft_f32.h"
+#include "core/cpu.h"
+#include "core/parallel.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FFT_F32_X86 1
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// --- Partie 1 : Papillons vectorisés ---
+//
+// Un papillon radix-2 combine a et b avec le facteur w :
+//   t = w * b ;  b = a - t ;  a = a + t
+// Deux variantes : w différent pour chaque élément (FFT des lignes, on
+// vectorise sur les papillons d'un étage) ou w identique pour tous
+// (FFT des colonnes, on vectorise sur la largeur de l'image).
+// Les trois implémentations (scalaire, SSE2, AVX2) font exactement les mêmes
+// opérations flottantes dans le même ordre : le résultat ne dépend pas du CPU.
+
+typedef void (*ButterflyFn)(float *ar, float *ai, float *br, float *bi,
+                            const float *wr, const float *wi, int count);
+typedef void (*ButterflyBcastFn)(float *ar, float *ai, float *br, float *bi,
+                                 float wr, float wi, int count);
+
+static void butterfly_scalar(float *ar, float *ai, float *br, float *bi,
+                             const float *wr, const float *wi, int count) {
+    for (int i = 0; i < count; i++) {
+        float tr = br[i] * wr[i] - bi[i] * wi[i];
+        float ti = br[i] * wi[i] + bi[i] * wr[i];
+        br[i] = ar[i] - tr;
+        bi[i] = ai[i] - ti;
+        ar[i] = ar[i] + tr;
+        ai[i] = ai[i] + ti;
+    }
+}
+
+static void butterfly_bcast_scalar(float *ar, float *ai, float *br, float *bi,
+                                   float wr, float wi, int count) {
+    for (int i = 0; i < count; i++) {
+        float tr = br[i] * wr - bi[i] * wi;
+        float ti = br[i] * wi + bi[i] * wr;
+        br[i] = ar[i] - tr;
+        bi[i] = ai[i] - ti;
+        ar[i] = ar[i] + tr;
+        ai[i] = ai[i] + ti;
+    }
+}
+
+#if defined(FFT_F32_X86) && defined(__SSE2__)
+static void butterfly_sse2(float *ar, float *ai, float *br, float *bi,
+                           const float *wr, const float *wi, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vbr = _mm_loadu_ps(br + i), vbi = _mm_loadu_ps(bi + i);
+        __m128 vwr = _mm_loadu_ps(wr + i), vwi = _mm_loadu_ps(wi + i);
+        __m128 var = _mm_loadu_ps(ar + i), vai = _mm_loadu_ps(ai + i);
+        __m128 tr = _mm_sub_ps(_mm_mul_ps(vbr, vwr), _mm_mul_ps(vbi, vwi));
+        __m128 ti = _mm_add_ps(_mm_mul_ps(vbr, vwi), _mm_mul_ps(vbi, vwr));
+        _mm_storeu_ps(br + i, _mm_sub_ps(var, tr));
+        _mm_storeu_ps(bi + i, _mm_sub_ps(vai, ti));
+        _mm_storeu_ps(ar + i, _mm_add_ps(var, tr));
+        _mm_storeu_ps(ai + i, _mm_add_ps(vai, ti));
+    }
+    butterfly_scalar(ar + i, ai + i, br + i, bi + i, wr + i, wi + i, count - i);
+}
+
+static void butterfly_bcast_sse2(float *ar, float *ai, float *br, float *bi,
+                                 float wr, float wi, int count) {
+    __m128 vwr = _mm_set1_ps(wr), vwi = _mm_set1_ps(wi);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vbr = _mm_loadu_ps(br + i), vbi = _mm_loadu_ps(bi + i);
+        __m128 var = _mm_loadu_ps(ar + i), vai = _mm_loadu_ps(ai + i);
+        __m128 tr = _mm_sub_ps(_mm_mul_ps(vbr, vwr), _mm_mul_ps(vbi, vwi));
+        __m128 ti = _mm_add_ps(_mm_mul_ps(vbr, vwi), _mm_mul_ps(vbi, vwr));
+        _mm_storeu_ps(br + i, _mm_sub_ps(var, tr));
+        _mm_storeu_ps(bi + i, _mm_sub_ps(vai, ti));
+        _mm_storeu_ps(ar + i, _mm_add_ps(var, tr));
+        _mm_storeu_ps(ai + i, _mm_add_ps(vai, ti));
+    }
+    butterfly_bcast_scalar(ar + i, ai + i, br + i, bi + i, wr, wi, count - i);
+}
+#endif
+
+#ifdef FFT_F32_X86
+__attribute__((target("avx2")))
+static void butterfly_avx2(float *ar, float *ai, float *br, float *bi,
+                           const float *wr, const float *wi, int count) {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vbr = _mm256_loadu_ps(br + i), vbi = _mm256_loadu_ps(bi + i);
+        __m256 vwr = _mm256_loadu_ps(wr + i), vwi = _mm256_loadu_ps(wi + i);
+        __m256 var = _mm256_loadu_ps(ar + i), vai = _mm256_loadu_ps(ai + i);
+        __m256 tr = _mm256_sub_ps(_mm256_mul_ps(vbr, vwr), _mm256_mul_ps(vbi, vwi));
+        __m256 ti = _mm256_add_ps(_mm256_mul_ps(vbr, vwi), _mm256_mul_ps(vbi, vwr));
+        _mm256_storeu_ps(br + i, _mm256_sub_ps(var, tr));
+        _mm256_storeu_ps(bi + i, _mm256_sub_ps(vai, ti));
+        _mm256_storeu_ps(ar + i, _mm256_add_ps(var, tr));
+        _mm256_storeu_ps(ai + i, _mm256_add_ps(vai, ti));
+    }
+    // Retour en mode SSE sans pénalité de transition AVX -> SSE
+    _mm256_zeroupper();
+    butterfly_scalar(ar + i, ai + i, br + i, bi + i, wr + i, wi + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void butterfly_bcast_avx2(float *ar, float *ai, float *br, float *bi,
+                                 float wr, float wi, int count) {
+    __m256 vwr = _mm256_set1_ps(wr), vwi = _mm256_set1_ps(wi);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vbr = _mm256_loadu_ps(br + i), vbi = _mm256_loadu_ps(bi + i);
+        __m256 var = _mm256_loadu_ps(ar + i), vai = _mm256_loadu_ps(ai + i);
+        __m256 tr = _mm256_sub_ps(_mm256_mul_ps(vbr, vwr), _mm256_mul_ps(vbi, vwi));
+        __m256 ti = _mm256_add_ps(_mm256_mul_ps(vbr, vwi), _mm256_mul_ps(vbi, vwr));
+        _mm256_storeu_ps(br + i, _mm256_sub_ps(var, tr));
+        _mm256_storeu_ps(bi + i, _mm256_sub_ps(vai, ti));
+        _mm256_storeu_ps(ar + i, _mm256_add_ps(var, tr));
+        _mm256_storeu_ps(ai + i, _mm256_add_ps(vai, ti));
+    }
+    _mm256_zeroupper();
+    butterfly_bcast_scalar(ar + i, ai + i, br + i, bi + i, wr, wi, count - i);
+}
+#endif
+
+typedef struct {
+    ButterflyFn butterfly;
+    ButterflyBcastFn butterfly_bcast;
+    int vector_width; // En dessous, les petits étages sont faits en scalaire
+} ButterflyKernels;
+
+static ButterflyKernels select_kernels(void) {
+    ButterflyKernels k = {butterfly_scalar, butterfly_bcast_scalar, 1};
+    SimdLevel level = cpu_simd_level();
+#ifdef FFT_F32_X86
+    if (level >= SIMD_AVX2) {
+        k.butterfly = butterfly_avx2;
+        k.butterfly_bcast = butterfly_bcast_avx2;
+        k.vector_width = 8;
+        return k;
+    }
+#endif
+#if defined(FFT_F32_X86) && defined(__SSE2__)
+    if (level >= SIMD_SSE2) {
+        k.butterfly = butterfly_sse2;
+        k.butterfly_bcast = butterfly_bcast_sse2;
+        k.vector_width = 4;
+    }
+#endif
+    (void)level;
+    return k;
+}
+
+// --- Partie 2 : Plan 1D (permutation et facteurs de rotation) ---
+
+typedef struct {
+    int n;
+    int *rev;    // Permutation par inversion des bits
+    float *twr;  // Facteurs de rotation, étage de demi-taille m à l'offset m-1
+    float *twi;
+} Plan1D;
+
+static void plan_free(Plan1D *p) {
+    free(p->rev);
+    free(p->twr);
+    free(p->twi);
+}
+
+static int plan_init(Plan1D *p, int n, int inverse) {
+    p->n = n;
+    p->rev = malloc(n * sizeof(int));
+    p->twr = malloc((n > 1 ? n - 1 : 1) * sizeof(float));
+    p->twi = malloc((n > 1 ? n - 1 : 1) * sizeof(float));
+    if (!p->rev || !p->twr || !p->twi) {
+        plan_free(p);
+        return -1;
+    }
+
+    int bits = 0;
+    while ((1 << bits) < n) bits++;
+    for (int i = 0; i < n; i++) {
+        int r = 0;
+        for (int b = 0; b < bits; b++) {
+            if (i & (1 << b)) r |= 1 << (bits - 1 - b);
+        }
+        p->rev[i] = r;
+    }
+
+    // Les cos/sin sont calculés en double puis arrondis une seule fois en float.
+    double sign = inverse ? 1.0 : -1.0;
+    for (int m = 1; m < n; m <<= 1) {
+        for (int k = 0; k < m; k++) {
+            double angle = sign * M_PI * k / m;
+            p->twr[m - 1 + k] = (float)cos(angle);
+            p->twi[m - 1 + k] = (float)sin(angle);
+        }
+    }
+    return 0;
+}
+
+// --- Partie 3 : FFT des lignes (vectorisée sur les papillons d'un étage) ---
+
+static void fft_row_f32(float *re, float *im, const Plan1D *p, const ButterflyKernels *k) {
+    int n = p->n;
+
+    for (int i = 0; i < n; i++) {
+        int j = p->rev[i];
+        if (i < j) {
+            float t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    for (int m = 1; m < n; m <<= 1) {
+        const float *wr = p->twr + m - 1;
+        const float *wi = p->twi + m - 1;
+        if (m >= k->vector_width) {
+            for (int s = 0; s < n; s += 2 * m) {
+                k->butterfly(re + s, im + s, re + s + m, im + s + m, wr, wi, m);
+            }
+        } else {
+            // Petits étages : trop peu de papillons contigus pour un vecteur
+            for (int s = 0; s < n; s += 2 * m) {
+                butterfly_scalar(re + s, im + s, re + s + m, im + s + m, wr, wi, m);
+            }
+        }
+    }
+}
+
+// --- Partie 4 : FFT des colonnes (vectorisée sur la largeur) ---
+// Le papillon entre les lignes a et b s'applique à toute une bande [x0, x1)
+// de ces deux lignes avec le même facteur w : accès contigus, pas de transposition.
+
+static void fft_columns_f32(SplitComplexPlane *plane, int x0, int x1,
+                            const Plan1D *p, const ButterflyKernels *k) {
+    int n = p->n;
+    int w = plane->width;
+    int count = x1 - x0;
+
+    for (int y = 0; y < n; y++) {
+        int j = p->rev[y];
+        if (y < j) {
+            float *ra = plane->re + (size_t)y * w + x0, *rb = plane->re + (size_t)j * w + x0;
+            float *ia = plane->im + (size_t)y * w + x0, *ib = plane->im + (size_t)j * w + x0;
+            for (int x = 0; x < count; x++) {
+                float t = ra[x]; ra[x] = rb[x]; rb[x] = t;
+                t = ia[x]; ia[x] = ib[x]; ib[x] = t;
+            }
+        }
+    }
+
+    for (int m = 1; m < n; m <<= 1) {
+        for (int s = 0; s < n; s += 2 * m) {
+            for (int j = 0; j < m; j++) {
+                size_t a = (size_t)(s + j) * w + x0;
+                size_t b = a + (size_t)m * w;
+                k->butterfly_bcast(plane->re + a, plane->im + a, plane->re + b, plane->im + b,
+                                   p->twr[m - 1 + j], p->twi[m - 1 + j], count);
+            }
+        }
+    }
+}
+
+// --- Partie 5 : FFT 2D parallèle ---
+
+// Largeur des bandes de colonnes confiées aux threads (multiple de 8 floats)
+#define COLUMN_STRIPE 8
+
+typedef struct {
+    SplitComplexPlane *plane;
+    const Plan1D *row_plan;
+    const Plan1D *col_plan;
+    ButterflyKernels kernels;
+} FFTF32Context;
+
+static void _rows_worker(void *arg, int begin, int end, int thread_id) {
+    FFTF32Context *ctx = (FFTF32Context *)arg;
+    (void)thread_id;
+    int w = ctx->plane->width;
+    for (int y = begin; y < end; y++) {
+        fft_row_f32(ctx->plane->re + (size_t)y * w, ctx->plane->im + (size_t)y * w,
+                    ctx->row_plan, &ctx->kernels);
+    }
+}
+
+static void _columns_worker(void *arg, int begin, int end, int thread_id) {
+    FFTF32Context *ctx = (FFTF32Context *)arg;
+    (void)thread_id;
+    int x0 = begin * COLUMN_STRIPE;
+    int x1 = end * COLUMN_STRIPE;
+    if (x1 > ctx->plane->width) x1 = ctx->plane->width;
+    fft_columns_f32(ctx->plane, x0, x1, ctx->col_plan, &ctx->kernels);
+}
+
+SplitComplexPlane *split_plane_create(int width, int height) {
+    SplitComplexPlane *plane = malloc(sizeof(SplitComplexPlane));
+    if (!plane) return NULL;
+    plane->width = width;
+    plane->height = height;
+    plane->re = NULL;
+    plane->im = NULL;
+
+    // Alignement sur 32 octets pour les chargements AVX
+    size_t size = (size_t)width * height * sizeof(float);
+    if (posix_memalign((void **)&plane->re, 32, size) != 0 ||
+        posix_memalign((void **)&plane->im, 32, size) != 0) {
+        split_plane_free(plane);
+        return NULL;
+    }
+    memset(plane->re, 0, size);
+    memset(plane->im, 0, size);
+    return plane;
+}
+
+void split_plane_free(SplitComplexPlane *plane) {
+    if (plane) {
+        free(plane->re);
+        free(plane->im);
+        free(plane);
+    }
+}
+
+// Plan 2D réutilisable : permutations et facteurs de rotation des deux sens
+struct FFTF32Plan {
+    int width;
+    int height;
+    Plan1D row_plan[2]; // [0] directe, [1] inverse
+    Plan1D col_plan[2];
+    ButterflyKernels kernels;
+};
+
+FFTF32Plan *fft_f32_plan_create(int width, int height) {
+    FFTF32Plan *plan = calloc(1, sizeof(FFTF32Plan));
+    if (!plan) return NULL;
+    plan->width = width;
+    plan->height = height;
+    for (int inverse = 0; inverse < 2; inverse++) {
+        if (plan_init(&plan->row_plan[inverse], width, inverse) != 0 ||
+            plan_init(&plan->col_plan[inverse], height, inverse) != 0) {
+            fft_f32_plan_free(plan);
+            return NULL;
+        }
+    }
+    plan->kernels = select_kernels();
+    return plan;
+}
+
+void fft_f32_plan_free(FFTF32Plan *plan) {
+    if (plan) {
+        // plan_free tolère les plans non initialisés (pointeurs NULL du calloc)
+        for (int inverse = 0; inverse < 2; inverse++) {
+            plan_free(&plan->row_plan[inverse]);
+            plan_free(&plan->col_plan[inverse]);
+        }
+        free(plan);
+    }
+}
+
+int fft2d_f32_execute(const FFTF32Plan *plan, SplitComplexPlane *plane, int inverse) {
+    if (!plan || !plane || plane->width != plan->width || plane->height != plan->height) {
+        return -1;
+    }
+    inverse = inverse ? 1 : 0;
+    FFTF32Context ctx = {plane, &plan->row_plan[inverse], &plan->col_plan[inverse], plan->kernels};
+
+    int threads = parallel_thread_count(plane->height, 8);
+    parallel_for(plane->height, threads, _rows_worker, &ctx);
+
+    int stripes = (plane->width + COLUMN_STRIPE - 1) / COLUMN_STRIPE;
+    threads = parallel_thread_count(stripes, 4);
+    parallel_for(stripes, threads, _columns_worker, &ctx);
+    return 0;
+}
+
+int fft2d_f32_inplace(SplitComplexPlane *plane, int inverse) {
+    FFTF32Plan *plan = fft_f32_plan_create(plane->width, plane->height);
+    if (!plan) return -1;
+    int status = fft2d_f32_execute(plan, plane, inverse);
+    fft_f32_plan_free(plan);
+    return status;
+}
@@ -0,0 +1,162 @@
+#include "fft/fft_tiled.h"
+#include "core/parallel.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+FFTTilePlan *fft_tile_plan_create(int tile_size, int halo) {
+    if (tile_size < 16 || (tile_size & (tile_size - 1)) != 0) {
+        fprintf(stderr, "fft_tile_plan_create: La taille de bloc doit être une puissance de 2 (>= 16).\n");
+        return NULL;
+    }
+    if (halo < 0 || 2 * halo >= tile_size) {
+        fprintf(stderr, "fft_tile_plan_create: Halo invalide (%d) pour des blocs de %d.\n", halo, tile_size);
+        return NULL;
+    }
+
+    FFTTilePlan *plan = calloc(1, sizeof(FFTTilePlan));
+    if (!plan) return NULL;
+    plan->tile_size = tile_size;
+    plan->halo = halo;
+    plan->core_size = tile_size - 2 * halo;
+
+    plan->filter = freq_filter_create(tile_size, tile_size);
+    plan->fft_plan = fft_f32_plan_create(tile_size, tile_size);
+    plan->transfer = malloc((size_t)tile_size * tile_size * sizeof(float));
+    plan->num_buffers = parallel_get_num_threads();
+    plan->buffers = calloc(plan->num_buffers, sizeof(SplitComplexPlane *));
+    if (!plan->filter || !plan->fft_plan || !plan->transfer || !plan->buffers) {
+        fft_tile_plan_free(plan);
+        return NULL;
+    }
+    for (int t = 0; t < plan->num_buffers; t++) {
+        plan->buffers[t] = split_plane_create(tile_size, tile_size);
+        if (!plan->buffers[t]) {
+            fft_tile_plan_free(plan);
+            return NULL;
+        }
+    }
+    return plan;
+}
+
+void fft_tile_plan_free(FFTTilePlan *plan) {
+    if (plan) {
+        if (plan->buffers) {
+            for (int t = 0; t < plan->num_buffers; t++) split_plane_free(plan->buffers[t]);
+            free(plan->buffers);
+        }
+        free(plan->transfer);
+        fft_f32_plan_free(plan->fft_plan);
+        freq_filter_free(plan->filter);
+        free(plan);
+    }
+}
+
+// --- Traitement d'un bloc ---
+
+typedef struct {
+    const FFTTilePlan *plan;
+    const Image *src;
+    Image *dest;
+    int tiles_x;
+    int has_filter; // 0 si H = 1 partout : FFT inutile
+} TileContext;
+
+static void _filter_tile(const TileContext *ctx, SplitComplexPlane *buf, int tile_index) {
+    const FFTTilePlan *plan = ctx->plan;
+    const Image *src = ctx->src;
+    int n = plan->tile_size;
+    int core_x = (tile_index % ctx->tiles_x) * plan->core_size;
+    int core_y = (tile_index / ctx->tiles_x) * plan->core_size;
+    int x0 = core_x - plan->halo;
+    int y0 = core_y - plan->halo;
+
+    // 1. Lecture du bloc avec son halo (bords répétés hors de l'image)
+    for (int y = 0; y < n; y++) {
+        int sy = y0 + y;
+        if (sy < 0) sy = 0;
+        if (sy >= src->height) sy = src->height - 1;
+        const uint8_t *src_row = src->data + (size_t)sy * src->width;
+        float *re = buf->re + (size_t)y * n;
+        float *im = buf->im + (size_t)y * n;
+        for (int x = 0; x < n; x++) {
+            int sx = x0 + x;
+            if (sx < 0) sx = 0;
+            if (sx >= src->width) sx = src->width - 1;
+            re[x] = src_row[sx];
+            im[x] = 0.0f;
+        }
+    }
+
+    // 2. Filtrage fréquentiel : FFT, produit par H, FFT inverse
+    float scale = 1.0f;
+    if (ctx->has_filter) {
+        fft2d_f32_execute(plan->fft_plan, buf, 0);
+        for (size_t i = 0; i < (size_t)n * n; i++) {
+            float h = plan->transfer[i];
+            if (h != 1.0f) {
+                buf->re[i] *= h;
+                buf->im[i] *= h;
+            }
+        }
+        fft2d_f32_execute(plan->fft_plan, buf, 1);
+        scale = 1.0f / ((float)n * n);
+    }
+
+    // 3. Écriture du centre du bloc uniquement (le halo est jeté)
+    int w = plan->core_size;
+    int h = plan->core_size;
+    if (core_x + w > src->width) w = src->width - core_x;
+    if (core_y + h > src->height) h = src->height - core_y;
+    for (int y = 0; y < h; y++) {
+        const float *re = buf->re + (size_t)(y + plan->halo) * n + plan->halo;
+        uint8_t *dst = ctx->dest->data + (size_t)(core_y + y) * src->width + core_x;
+        for (int x = 0; x < w; x++) {
+            double val = re[x] * scale;
+            val += FLOAT_TRUNCATION_GUARD;
+            if (val < 0) val = 0;
+            if (val > 255) val = 255;
+            dst[x] = (uint8_t)val;
+        }
+    }
+}
+
+static void _tiles_worker(void *arg, int begin, int end, int thread_id) {
+    TileContext *ctx = (TileContext *)arg;
+    SplitComplexPlane *buf = ctx->plan->buffers[thread_id];
+    for (int t = begin; t < end; t++) {
+        _filter_tile(ctx, buf, t);
+    }
+}
+
+Image *fft_tiled_filter(FFTTilePlan *plan, const Image *src) {
+    if (!plan || !src || !src->data || src->channels != 1) {
+        fprintf(stderr, "fft_tiled_filter: Image invalide ou non supportée.\n");
+        return NULL;
+    }
+
+    // H est construite sur la grille du bloc, puis copiée en float
+    const double *transfer = freq_filter_build(plan->filter);
+    if (!transfer) return NULL;
+    int n = plan->tile_size;
+    int has_filter = 0;
+    for (size_t i = 0; i < (size_t)n * n; i++) {
+        plan->transfer[i] = (float)transfer[i];
+        if (transfer[i] != 1.0) has_filter = 1;
+    }
+
+    Image *dest = createImage(src->width, src->height, 1);
+    if (!dest) return NULL;
+
+    int tiles_x = (src->width + plan->core_size - 1) / plan->core_size;
+    int tiles_y = (src->height + plan->core_size - 1) / plan->core_size;
+    int num_tiles = tiles_x * tiles_y;
+    TileContext ctx = {plan, src, dest, tiles_x, has_filter};
+
+    // Un bloc par morceau au minimum ; le nombre de morceaux est borné par
+    // le nombre de buffers du plan (un par thread)
+    int threads = parallel_thread_count(num_tiles, 1);
+    if (threads > plan->num_buffers) threads = plan->num_buffers;
+    parallel_for(num_tiles, threads, _tiles_worker, &ctx);
+
+    return dest;
+}
@@ -0,0 +1,408 @@
+#include "fft/freq_filter.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+FreqFilter *freq_filter_create(int width, int height) {
+    if (width <= 0 || height <= 0) return NULL;
+    FreqFilter *filter = calloc(1, sizeof(FreqFilter));
+    if (!filter) return NULL;
+    filter->width = width;
+    filter->height = height;
+    filter->scale_x = 1.0;
+    filter->scale_y = 1.0;
+    return filter;
+}
+
+int freq_filter_set_reference(FreqFilter *filter, int ref_width, int ref_height) {
+    if (!filter || ref_width <= 0 || ref_height <= 0) return -1;
+    filter->scale_x = (double)ref_width / filter->width;
+    filter->scale_y = (double)ref_height / filter->height;
+    filter->transfer_valid = 0;
+    return 0;
+}
+
+void freq_filter_free(FreqFilter *filter) {
+    if (filter) {
+        free(filter->radial_ops);
+        free(filter->notches);
+        free(filter->transfer);
+        free(filter);
+    }
+}
+
+// --- Ajout d'opérations ---
+
+static int _add_radial(FreqFilter *filter, FreqOpType type, int radius, double k_low, double k_high) {
+    if (filter->radial_count == filter->radial_capacity) {
+        int capacity = filter->radial_capacity ? filter->radial_capacity * 2 : 4;
+        FreqRadialOp *ops = realloc(filter->radial_ops, capacity * sizeof(FreqRadialOp));
+        if (!ops) return -1;
+        filter->radial_ops = ops;
+        filter->radial_capacity = capacity;
+    }
+    FreqRadialOp *op = &filter->radial_ops[filter->radial_count++];
+    op->type = type;
+    op->radius_squared = (double)radius * radius;
+    op->k_low = k_low;
+    op->k_high = k_high;
+    filter->transfer_valid = 0;
+    return 0;
+}
+
+int freq_filter_add_lowpass(FreqFilter *filter, int radius) {
+    return _add_radial(filter, FREQ_OP_LOWPASS, radius, 1.0, 0.0);
+}
+
+int freq_filter_add_highpass(FreqFilter *filter, int radius) {
+    return _add_radial(filter, FREQ_OP_HIGHPASS, radius, 0.0, 1.0);
+}
+
+int freq_filter_add_emphasis(FreqFilter *filter, int radius, double k_low, double k_high) {
+    return _add_radial(filter, FREQ_OP_EMPHASIS, radius, k_low, k_high);
+}
+
+int freq_filter_add_notch(FreqFilter *filter, int u, int v, int radius) {
+    if (filter->notch_count == filter->notch_capacity) {
+        int capacity = filter->notch_capacity ? filter->notch_capacity * 2 : 16;
+        NotchFilter *notches = realloc(filter->notches, capacity * sizeof(NotchFilter));
+        if (!notches) return -1;
+        filter->notches = notches;
+        filter->notch_capacity = capacity;
+    }
+    NotchFilter *n = &filter->notches[filter->notch_count++];
+    n->u = u;
+    n->v = v;
+    n->radius = radius;
+    filter->transfer_valid = 0;
+    return 0;
+}
+
+int freq_filter_op_count(const FreqFilter *filter) {
+    return filter ? filter->radial_count + filter->notch_count : 0;
+}
+
+// --- Construction de H(u,v) ---
+
+// Met H à zéro dans le disque de rayon 'radius' centré en (u,v) (coordonnées
+// centrées, comme fft_notch_filter). Seule la boîte englobante est visitée.
+// Avec une grille de référence (scale != 1), le disque est défini en
+// fréquences de référence : centre et rayon sont ramenés à la grille de H.
+static void _zero_notch_disc(double *transfer, int width, int height, int u, int v, int radius,
+                             double scale_x, double scale_y) {
+    int center_x = width / 2;
+    int center_y = height / 2;
+    if (radius < 0) radius = -radius;
+    double radius_squared = (double)radius * radius;
+
+    int cu_center = u, cv_center = v;
+    int half_u = radius, half_v = radius;
+    if (scale_x != 1.0 || scale_y != 1.0) {
+        cu_center = (int)lround(u / scale_x);
+        cv_center = (int)lround(v / scale_y);
+        half_u = (int)ceil(radius / scale_x);
+        half_v = (int)ceil(radius / scale_y);
+    }
+
+    // Boîte englobante, limitée au spectre centré [-center, taille - center - 1]
+    int u0 = cu_center - half_u < -center_x ? -center_x : cu_center - half_u;
+    int u1 = cu_center + half_u > width - 1 - center_x ? width - 1 - center_x : cu_center + half_u;
+    int v0 = cv_center - half_v < -center_y ? -center_y : cv_center - half_v;
+    int v1 = cv_center + half_v > height - 1 - center_y ? height - 1 - center_y : cv_center + half_v;
+
+    for (int cv = v0; cv <= v1; cv++) {
+        double dv = (cv - cv_center) * scale_y;
+        // Coordonnée centrée -> indice de ligne dans la matrice non décalée
+        double *row = transfer + (size_t)((cv + 2 * center_y) % height) * width;
+        for (int cu = u0; cu <= u1; cu++) {
+            double du = (cu - cu_center) * scale_x;
+            if (du * du + dv * dv <= radius_squared) {
+                row[(cu + 2 * center_x) % width] = 0.0;
+            }
+        }
+    }
+}
+
+const double *freq_filter_build(FreqFilter *filter) {
+    if (!filter) return NULL;
+    if (filter->transfer && filter->transfer_valid) return filter->transfer;
+
+    int width = filter->width;
+    int height = filter->height;
+    if (!filter->transfer) {
+        filter->transfer = malloc((size_t)width * height * sizeof(double));
+        if (!filter->transfer) return NULL;
+    }
+    double *transfer = filter->transfer;
+
+    // 1. Opérations radiales. Distance au centre du spectre NON décalé :
+    //    d² = dx²(x) + dy²(y), les deux termes étant précalculés une fois
+    //    (en fréquences de la grille de référence, voir freq_filter_set_reference).
+    if (filter->radial_count == 0) {
+        for (size_t i = 0; i < (size_t)width * height; i++) transfer[i] = 1.0;
+    } else {
+        double *dx2 = malloc(width * sizeof(double));
+        double *dy2 = malloc(height * sizeof(double));
+        if (!dx2 || !dy2) {
+            free(dx2);
+            free(dy2);
+            return NULL;
+        }
+        int center_x = width / 2;
+        int center_y = height / 2;
+        for (int x = 0; x < width; x++) {
+            double dx = (x < center_x ? x : width - x) * filter->scale_x;
+            dx2[x] = dx * dx;
+        }
+        for (int y = 0; y < height; y++) {
+            double dy = (y < center_y ? y : height - y) * filter->scale_y;
+            dy2[y] = dy * dy;
+        }
+
+        for (int y = 0; y < height; y++) {
+            double *row = transfer + (size_t)y * width;
+            for (int x = 0; x < width; x++) {
+                double dist_sq = dx2[x] + dy2[y];
+                double factor = 1.0;
+                for (int k = 0; k < filter->radial_count; k++) {
+                    const FreqRadialOp *op = &filter->radial_ops[k];
+                    factor *= (dist_sq <= op->radius_squared) ? op->k_low : op->k_high;
+                }
+                row[x] = factor;
+            }
+        }
+        free(dx2);
+        free(dy2);
+    }
+
+    // 2. Notch : chaque pic et son symétrique, limités à leur boîte englobante
+    for (int i = 0; i < filter->notch_count; i++) {
+        const NotchFilter *n = &filter->notches[i];
+        _zero_notch_disc(transfer, width, height, n->u, n->v, n->radius,
+                         filter->scale_x, filter->scale_y);
+        _zero_notch_disc(transfer, width, height, -n->u, -n->v, n->radius,
+                         filter->scale_x, filter->scale_y);
+    }
+
+    filter->transfer_valid = 1;
+    return transfer;
+}
+
+int freq_filter_apply(FreqFilter *filter, Complex **fft_data) {
+    const double *transfer = freq_filter_build(filter);
+    if (!transfer || !fft_data) return -1;
+
+    // Une seule passe de multiplication ; H = 1 laisse la fréquence intacte.
+    for (int y = 0; y < filter->height; y++) {
+        const double *h = transfer + (size_t)y * filter->width;
+        Complex *row = fft_data[y];
+        for (int x = 0; x < filter->width; x++) {
+            if (h[x] == 0.0) {
+                row[x].real = 0;
+                row[x].imag = 0;
+            } else if (h[x] != 1.0) {
+                row[x].real *= h[x];
+                row[x].imag *= h[x];
+            }
+        }
+    }
+    return 0;
+}
+
+int freq_filter_apply_plane(FreqFilter *filter, SplitComplexPlane *plane) {
+    const double *transfer = freq_filter_build(filter);
+    if (!transfer || !plane || plane->width != filter->width || plane->height != filter->height) return -1;
+
+    for (size_t i = 0; i < (size_t)filter->width * filter->height; i++) {
+        if (transfer[i] == 0.0) {
+            plane->re[i] = 0.0f;
+            plane->im[i] = 0.0f;
+        } else if (transfer[i] != 1.0) {
+            plane->re[i] = (float)(plane->re[i] * transfer[i]);
+            plane->im[i] = (float)(plane->im[i] * transfer[i]);
+        }
+    }
+    return 0;
+}
+
+// --- Détection automatique des pics de bruit ---
+
+// Nombre maximal de paires de pics supprimées par la détection automatique
+#define MAX_AUTO_NOTCH_PAIRS 32
+
+typedef struct {
+    int u;
+    int v;
+    double magnitude_sq;
+} NoisePeak;
+
+// Tri des pics par magnitude décroissante
+static int compare_peaks_desc(const void *a, const void *b) {
+    double m1 = ((const NoisePeak *)a)->magnitude_sq;
+    double m2 = ((const NoisePeak *)b)->magnitude_sq;
+    if (m1 > m2) return -1;
+    if (m1 < m2) return 1;
+    return 0;
+}
+
+// Sélection rapide (quickselect) : place en values[k] l'élément de rang k,
+// comme si le tableau était trié. O(n) en moyenne, le tableau est permuté.
+static double _select_kth(double *values, long n, long k) {
+    long left = 0;
+    long right = n - 1;
+    while (left < right) {
+        // Pivot : médiane de trois, pour éviter le pire cas sur un spectre déjà ordonné
+        long mid = left + (right - left) / 2;
+        double a = values[left], b = values[mid], c = values[right];
+        double pivot = (a < b) ? ((b < c) ? b : (a < c ? c : a)) : ((a < c) ? a : (b < c ? c : b));
+
+        // Partition de Hoare
+        long i = left;
+        long j = right;
+        while (i <= j) {
+            while (values[i] < pivot) i++;
+            while (values[j] > pivot) j--;
+            if (i <= j) {
+                double t = values[i]; values[i] = values[j]; values[j] = t;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) right = j;
+        else if (k >= i) left = i;
+        else break; // values[k] == pivot
+    }
+    return values[k];
+}
+
+// |H * F|² au point (x, y) de la matrice non décalée
+static double _filtered_magnitude_sq(const double *transfer, Complex **fft_data, int width, int x, int y) {
+    double h = transfer[y * width + x];
+    if (h == 0.0) return 0.0;
+    Complex c = fft_data[y][x];
+    if (h != 1.0) {
+        c.real *= h;
+        c.imag *= h;
+    }
+    return c.real * c.real + c.imag * c.imag;
+}
+
+int freq_filter_add_auto_notches(FreqFilter *filter, Complex **fft_data, double threshold_factor, int radius) {
+    const double *transfer = freq_filter_build(filter);
+    if (!transfer || !fft_data) return -1;
+
+    int width = filter->width;
+    int height = filter->height;
+    long total_pixels = (long)width * height;
+    int center_x = width / 2;
+    int center_y = height / 2;
+
+    // 1. Médiane de |H * F| par sélection en O(n) (le tableau est ensuite inutile)
+    double *magnitudes = malloc(total_pixels * sizeof(double));
+    if (!magnitudes) return -1;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            magnitudes[(long)y * width + x] = sqrt(_filtered_magnitude_sq(transfer, fft_data, width, x, y));
+        }
+    }
+    double median_magnitude = _select_kth(magnitudes, total_pixels, total_pixels / 2);
+    free(magnitudes);
+
+    double noise_threshold = median_magnitude * threshold_factor;
+    double threshold_sq = noise_threshold * noise_threshold;
+    printf("Détection auto: Médiane=%.2f, Seuil de bruit=%.2f\n", median_magnitude, noise_threshold);
+
+    // On ignore un rayon de 5% autour du centre pour ne pas toucher à l'image
+    double dc_radius = width * 0.05;
+    double dc_radius_sq = dc_radius * dc_radius;
+
+    // 2. Maxima locaux au-dessus du seuil (voisinage 3x3, spectre périodique).
+    //    En cas d'égalité, seul le premier dans l'ordre de parcours est gardé.
+    NoisePeak *peaks = NULL;
+    int peak_count = 0;
+    int peak_capacity = 0;
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int dx = x < center_x ? x : width - x;
+            int dy = y < center_y ? y : height - y;
+            if ((double)(dx * dx + dy * dy) < dc_radius_sq) continue;
+
+            double mag_sq = _filtered_magnitude_sq(transfer, fft_data, width, x, y);
+            if (!(mag_sq > threshold_sq)) continue;
+
+            int is_peak = 1;
+            for (int ny = -1; ny <= 1 && is_peak; ny++) {
+                for (int nx = -1; nx <= 1; nx++) {
+                    if (nx == 0 && ny == 0) continue;
+                    int xx = (x + nx + width) % width;
+                    int yy = (y + ny + height) % height;
+                    double neighbor = _filtered_magnitude_sq(transfer, fft_data, width, xx, yy);
+                    int before = (ny < 0) || (ny == 0 && nx < 0);
+                    if (neighbor > mag_sq || (before && neighbor == mag_sq)) {
+                        is_peak = 0;
+                        break;
+                    }
+                }
+            }
+            if (!is_peak) continue;
+
+            if (peak_count == peak_capacity) {
+                int capacity = peak_capacity ? peak_capacity * 2 : 64;
+                NoisePeak *grown = realloc(peaks, capacity * sizeof(NoisePeak));
+                if (!grown) {
+                    free(peaks);
+                    return -1;
+                }
+                peaks = grown;
+                peak_capacity = capacity;
+            }
+            // Coordonnées relatives au centre du spectre décalé
+            peaks[peak_count].u = (x + center_x) % width - center_x;
+            peaks[peak_count].v = (y + center_y) % height - center_y;
+            peaks[peak_count].magnitude_sq = mag_sq;
+            peak_count++;
+        }
+    }
+
+    // 3. Regroupement : du plus fort au plus faible, un pic situé dans le
+    //    disque d'un pic déjà retenu (ou de son symétrique) est absorbé.
+    //    Chaque pic retenu représente une paire (u,v) / (-u,-v).
+    if (peak_count == 0) return 0; // Aucun maximum local : peaks n'a pas été alloué
+    qsort(peaks, peak_count, sizeof(NoisePeak), compare_peaks_desc);
+
+    int cluster_radius = radius > 1 ? radius : 1;
+    long cluster_radius_sq = (long)cluster_radius * cluster_radius;
+    int kept = 0;
+    for (int i = 0; i < peak_count && kept < MAX_AUTO_NOTCH_PAIRS; i++) {
+        int absorbed = 0;
+        for (int j = 0; j < kept && !absorbed; j++) {
+            long du = peaks[i].u - peaks[j].u, dv = peaks[i].v - peaks[j].v;
+            long su = peaks[i].u + peaks[j].u, sv = peaks[i].v + peaks[j].v;
+            if (du * du + dv * dv <= cluster_radius_sq || su * su + sv * sv <= cluster_radius_sq) {
+                absorbed = 1;
+            }
+        }
+        if (!absorbed) {
+            peaks[kept++] = peaks[i]; // Compactage en place (kept <= i)
+        }
+    }
+
+    // 4. Ajouter un notch par paire retenue (la symétrie est gérée par le notch)
+    if (kept > 0) {
+        printf("%d maximum(s) local(aux) au-dessus du seuil, %d paire(s) de pics retenue(s) après regroupement.\n",
+               peak_count, kept);
+        for (int i = 0; i < kept; i++) {
+            printf("  - Suppression du bruit autour de (%d, %d) et (%d, %d)\n",
+                   peaks[i].u, peaks[i].v, -peaks[i].u, -peaks[i].v);
+            if (freq_filter_add_notch(filter, peaks[i].u, peaks[i].v, radius) != 0) {
+                free(peaks);
+                return -1;
+            }
+        }
+    }
+
+    free(peaks);
+    return kept;
+}
@@ -0,0 +1,105 @@
+#include "filters/adaptive_threshold.h"
+#include "core/parallel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Dynamique de l'écart-type pour Sauvola (R dans la formule originale)
+#define SAUVOLA_DYNAMIC_RANGE 128.0
+
+typedef struct {
+    uint8_t *data;
+    int width;
+    int height;
+    int half;                 // Demi-fenêtre
+    AdaptiveThresholdMethod method;
+    double k;
+    const uint64_t *sum;      // Image intégrale (width + 1) x (height + 1)
+    const uint64_t *sum_sq;   // Image intégrale des carrés (Sauvola seulement)
+} AdaptiveContext;
+
+static void _threshold_rows(void *ctx, int begin, int end, int thread_id) {
+    (void)thread_id;
+    AdaptiveContext *c = ctx;
+    int w = c->width;
+    size_t stride = (size_t)w + 1;
+
+    for (int y = begin; y < end; y++) {
+        int y0 = y - c->half < 0 ? 0 : y - c->half;
+        int y1 = y + c->half >= c->height ? c->height : y + c->half + 1;
+        const uint64_t *top = c->sum + (size_t)y0 * stride;
+        const uint64_t *bottom = c->sum + (size_t)y1 * stride;
+        uint8_t *row = c->data + (size_t)y * w;
+
+        for (int x = 0; x < w; x++) {
+            int x0 = x - c->half < 0 ? 0 : x - c->half;
+            int x1 = x + c->half >= w ? w : x + c->half + 1;
+            double area = (double)(x1 - x0) * (y1 - y0);
+            uint64_t s = bottom[x1] - bottom[x0] - top[x1] + top[x0];
+            double mean = s / area;
+
+            double threshold;
+            if (c->method == ADAPTIVE_BRADLEY) {
+                threshold = mean * (1.0 - c->k);
+            } else {
+                const uint64_t *top_sq = c->sum_sq + (size_t)y0 * stride;
+                const uint64_t *bottom_sq = c->sum_sq + (size_t)y1 * stride;
+                uint64_t s2 = bottom_sq[x1] - bottom_sq[x0] - top_sq[x1] + top_sq[x0];
+                double variance = s2 / area - mean * mean;
+                double stddev = variance > 0 ? sqrt(variance) : 0.0;
+                threshold = mean * (1.0 + c->k * (stddev / SAUVOLA_DYNAMIC_RANGE - 1.0));
+            }
+            row[x] = row[x] < threshold ? 0 : 255;
+        }
+    }
+}
+
+int apply_adaptive_threshold(Image *img, AdaptiveThresholdMethod method, int window, double k) {
+    if (!img || !img->data || img->channels != 1 || window < 1) {
+        fprintf(stderr, "apply_adaptive_threshold: Arguments invalides (image en niveaux de gris, fenêtre >= 1).\n");
+        return -1;
+    }
+    int w = img->width;
+    int h = img->height;
+    size_t stride = (size_t)w + 1;
+    int need_sq = method == ADAPTIVE_SAUVOLA;
+
+    uint64_t *sum = calloc(stride * (h + 1), sizeof(uint64_t));
+    uint64_t *sum_sq = need_sq ? calloc(stride * (h + 1), sizeof(uint64_t)) : NULL;
+    if (!sum || (need_sq && !sum_sq)) {
+        free(sum);
+        free(sum_sq);
+        return -1;
+    }
+
+    // Images intégrales : sum[y+1][x+1] = somme des pixels de [0, x] x [0, y]
+    for (int y = 0; y < h; y++) {
+        const uint8_t *row = img->data + (size_t)y * w;
+        const uint64_t *above = sum + (size_t)y * stride;
+        uint64_t *cur = sum + (size_t)(y + 1) * stride;
+        uint64_t acc = 0;
+        for (int x = 0; x < w; x++) {
+            acc += row[x];
+            cur[x + 1] = above[x + 1] + acc;
+        }
+        if (need_sq) {
+            const uint64_t *above_sq = sum_sq + (size_t)y * stride;
+            uint64_t *cur_sq = sum_sq + (size_t)(y + 1) * stride;
+            uint64_t acc_sq = 0;
+            for (int x = 0; x < w; x++) {
+                acc_sq += (uint64_t)row[x] * row[x];
+                cur_sq[x + 1] = above_sq[x + 1] + acc_sq;
+            }
+        }
+    }
+
+    // Le seuillage en place est sûr : les tables ne dépendent plus de l'image
+    AdaptiveContext c = {img->data, w, h, window / 2, method, k, sum, sum_sq};
+    parallel_for(h, parallel_thread_count(h, 16), _threshold_rows, &c);
+
+    free(sum);
+    free(sum_sq);
+    printf("Seuillage adaptatif (%s) appliqué (fenêtre %d, k=%.2f).\n",
+           method == ADAPTIVE_BRADLEY ? "Bradley-Roth" : "Sauvola", window, k);
+    return 0;
+}
@@ -1,7 +1,19 @@
 #include "filters/convolution.h"
+#include "fft/fft.h"
+#include "fft/fft_f32.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
+
+// Écrêtage et troncature des moteurs séparable et FFT. apply_convolution garde
+// sa troncature directe (sans marge), inchangée pour les filtres existants.
+static uint8_t _clamp_to_pixel(float sum) {
+    sum += FLOAT_TRUNCATION_GUARD;
+    if (sum < 0) sum = 0;
+    if (sum > 255) sum = 255;
+    return (uint8_t)sum;
+}
 
 Image *apply_convolution(const Image *src, const Kernel *kernel) {
     if (!src || !kernel || !src->data || !kernel->data) {
@@ -70,3 +82,316 @@ Image *apply_convolution(const Image *src, const Kernel *kernel) {
 // 3.  **Double boucle sur le noyau :** Pour chaque pixel, on applique le noyau. On superpose virtuellement le centre du noyau sur le pixel `(x, y)` et on regarde les pixels voisins.
 // 4.  **Gestion des bords :** C'est la partie la plus délicate (slide 11 du cours). La stratégie `clamp to edge` (ou "réplication de bord") est simple et efficace : si le noyau dépasse de l'image, on utilise la valeur du pixel le plus proche sur le bord. C'est mieux que de mettre du noir (ce qui créerait un cadre sombre).
 // 5.  **Calcul :** On fait la somme pondérée des pixels du voisinage et on stocke le résultat (après l'avoir ramené dans l'intervalle) dans l'image de destination.
+
+
+// --- Convolution séparable et convolution par FFT ---
+
+// Tolérance relative du test de séparabilité
+#define SEPARABLE_TOLERANCE 1e-4f
+
+// Modèle de coût, en multiplications-additions de la passe séparable
+// (boucle sans test, la plus rapide). Valeurs mesurées sur lena 356x372 :
+// - une case du noyau en spatial coûte environ 3 fois plus (tests de bord) ;
+// - un point de FFT par étage log2 : trois transformées (image, noyau,
+//   inverse) et le produit des spectres.
+#define SPATIAL_COST_PER_TAP 3.0
+#define FFT_COST_PER_POINT 4.5
+
+
+int kernel_is_separable(const Kernel *kernel, float *col, float *row) {
+    if (!kernel || !kernel->data) return 0;
+    int kw = kernel->width;
+    int kh = kernel->height;
+
+    // Pivot : le plus grand coefficient en valeur absolue
+    int pivot = 0;
+    for (int i = 1; i < kw * kh; i++) {
+        if (fabsf(kernel->data[i]) > fabsf(kernel->data[pivot])) pivot = i;
+    }
+    float max_abs = fabsf(kernel->data[pivot]);
+    if (max_abs == 0.0f) return 0;
+    int py = pivot / kw;
+    int px = pivot % kw;
+
+    // K[y][x] doit valoir K[y][px] * K[py][x] / K[py][px]
+    const float *k = kernel->data;
+    float tolerance = SEPARABLE_TOLERANCE * max_abs;
+    for (int y = 0; y < kh; y++) {
+        float c = k[y * kw + px] / k[pivot];
+        for (int x = 0; x < kw; x++) {
+            if (fabsf(k[y * kw + x] - c * k[py * kw + x]) > tolerance) return 0;
+        }
+    }
+
+    if (col && row) {
+        for (int y = 0; y < kh; y++) col[y] = k[y * kw + px] / k[pivot];
+        for (int x = 0; x < kw; x++) row[x] = k[py * kw + x];
+    }
+    return 1;
+}
+
+static double _fft_cost_per_pixel(const Image *src, const Kernel *kernel) {
+    double n = (double)fft_padded_size(src->width + kernel->width - 1) *
+               fft_padded_size(src->height + kernel->height - 1);
+    return FFT_COST_PER_POINT * n * log2(n) / ((double)src->width * src->height);
+}
+
+ConvolutionEngine convolution_select_engine(const Image *src, const Kernel *kernel) {
+    if (!src || !kernel || !kernel->data) return CONV_ENGINE_SPATIAL;
+
+    double spatial = SPATIAL_COST_PER_TAP * kernel->width * kernel->height;
+    double best = spatial;
+    ConvolutionEngine engine = CONV_ENGINE_SPATIAL;
+
+    // Séparable : deux passes plus l'aller-retour du buffer intermédiaire
+    double separable = kernel->width + kernel->height + 4.0;
+    if (separable < best && kernel_is_separable(kernel, NULL, NULL)) {
+        best = separable;
+        engine = CONV_ENGINE_SEPARABLE;
+    }
+
+    double fft = _fft_cost_per_pixel(src, kernel);
+    if (fft < best) {
+        engine = CONV_ENGINE_FFT;
+    }
+    return engine;
+}
+
+const char *convolution_engine_name(ConvolutionEngine engine) {
+    switch (engine) {
+        case CONV_ENGINE_SPATIAL: return "spatiale";
+        case CONV_ENGINE_SEPARABLE: return "séparable";
+        case CONV_ENGINE_FFT: return "FFT";
+        default: return "automatique";
+    }
+}
+
+static Image *_convolve_separable(const Image *src, const Kernel *kernel) {
+    int kw = kernel->width;
+    int kh = kernel->height;
+    int width = src->width;
+    int height = src->height;
+    int cx = kw / 2;
+    int cy = kh / 2;
+
+    float *col = malloc(kh * sizeof(float));
+    float *row = malloc(kw * sizeof(float));
+    float *line = malloc((width + kw - 1) * sizeof(float));
+    float *tmp = malloc((size_t)width * height * sizeof(float));
+    Image *dest = createImage(width, height, 1);
+    if (!col || !row || !line || !tmp || !dest || !kernel_is_separable(kernel, col, row)) {
+        free(col);
+        free(row);
+        free(line);
+        free(tmp);
+        freeImage(dest);
+        return NULL;
+    }
+
+    // 1. Passe horizontale, résultat non écrêté. Chaque ligne est d'abord
+    //    recopiée avec ses bords répétés : la boucle interne n'a plus de test.
+    for (int y = 0; y < height; y++) {
+        const uint8_t *src_row = src->data + (size_t)y * width;
+        for (int x = 0; x < width + kw - 1; x++) {
+            int ix = x - cx;
+            if (ix < 0) ix = 0;
+            if (ix >= width) ix = width - 1;
+            line[x] = src_row[ix];
+        }
+        float *tmp_row = tmp + (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            float sum = 0.0f;
+            for (int k = 0; k < kw; k++) {
+                sum += line[x + k] * row[k];
+            }
+            tmp_row[x] = sum;
+        }
+    }
+    free(line);
+
+    // 2. Passe verticale, ligne par ligne pour des accès contigus
+    float *acc = calloc(width, sizeof(float));
+    if (!acc) {
+        free(col);
+        free(row);
+        free(tmp);
+        freeImage(dest);
+        return NULL;
+    }
+    for (int y = 0; y < height; y++) {
+        memset(acc, 0, width * sizeof(float));
+        for (int k = 0; k < kh; k++) {
+            int iy = y + k - cy;
+            if (iy < 0) iy = 0;
+            if (iy >= height) iy = height - 1;
+            const float *tmp_row = tmp + (size_t)iy * width;
+            float c = col[k];
+            for (int x = 0; x < width; x++) {
+                acc[x] += tmp_row[x] * c;
+            }
+        }
+        uint8_t *dst = dest->data + (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            dst[x] = _clamp_to_pixel(acc[x]);
+        }
+    }
+
+    free(acc);
+    free(col);
+    free(row);
+    free(tmp);
+    return dest;
+}
+
+static Image *_convolve_fft(const Image *src, const Kernel *kernel) {
+    int kw = kernel->width;
+    int kh = kernel->height;
+    int width = src->width;
+    int height = src->height;
+    int cx = kw / 2;
+    int cy = kh / 2;
+
+    // Taille suffisante pour que la convolution circulaire ne replie rien
+    // sur les pixels gardés : image étendue de (K - 1) pixels.
+    int pw = fft_padded_size(width + kw - 1);
+    int ph = fft_padded_size(height + kh - 1);
+
+    SplitComplexPlane *image_plane = split_plane_create(pw, ph);
+    SplitComplexPlane *kernel_plane = split_plane_create(pw, ph);
+    FFTF32Plan *plan = fft_f32_plan_create(pw, ph);
+    Image *dest = createImage(width, height, 1);
+    if (!image_plane || !kernel_plane || !plan || !dest) {
+        split_plane_free(image_plane);
+        split_plane_free(kernel_plane);
+        fft_f32_plan_free(plan);
+        freeImage(dest);
+        return NULL;
+    }
+
+    // 1. Image étendue par répétition des bords : E[y][x] = src[y - cy][x - cx]
+    for (int y = 0; y < height + kh - 1; y++) {
+        int sy = y - cy;
+        if (sy < 0) sy = 0;
+        if (sy >= height) sy = height - 1;
+        const uint8_t *src_row = src->data + (size_t)sy * width;
+        float *re = image_plane->re + (size_t)y * pw;
+        for (int x = 0; x < width + kw - 1; x++) {
+            int sx = x - cx;
+            if (sx < 0) sx = 0;
+            if (sx >= width) sx = width - 1;
+            re[x] = src_row[sx];
+        }
+    }
+
+    // 2. Noyau retourné et replié sur l'origine : la convolution circulaire
+    //    calcule alors la même somme que apply_convolution (corrélation).
+    for (int ky = 0; ky < kh; ky++) {
+        int y = (ph - ky) % ph;
+        for (int kx = 0; kx < kw; kx++) {
+            int x = (pw - kx) % pw;
+            kernel_plane->re[(size_t)y * pw + x] = kernel->data[ky * kw + kx];
+        }
+    }
+
+    // 3. Produit des spectres, puis retour au domaine spatial
+    fft2d_f32_execute(plan, image_plane, 0);
+    fft2d_f32_execute(plan, kernel_plane, 0);
+    for (size_t i = 0; i < (size_t)pw * ph; i++) {
+        float ar = image_plane->re[i], ai = image_plane->im[i];
+        float br = kernel_plane->re[i], bi = kernel_plane->im[i];
+        image_plane->re[i] = ar * br - ai * bi;
+        image_plane->im[i] = ar * bi + ai * br;
+    }
+    fft2d_f32_execute(plan, image_plane, 1);
+
+    // 4. Le pixel (x, y) se trouve en (x, y) de la matrice (l'inverse n'est pas normalisée)
+    float scale = 1.0f / ((float)pw * ph);
+    for (int y = 0; y < height; y++) {
+        const float *re = image_plane->re + (size_t)y * pw;
+        uint8_t *dst = dest->data + (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            dst[x] = _clamp_to_pixel(re[x] * scale);
+        }
+    }
+
+    split_plane_free(image_plane);
+    split_plane_free(kernel_plane);
+    fft_f32_plan_free(plan);
+    return dest;
+}
+
+Image *apply_convolution_ex(const Image *src, const Kernel *kernel, ConvolutionEngine engine) {
+    if (!src || !kernel || !src->data || !kernel->data || kernel->width <= 0 || kernel->height <= 0) {
+        fprintf(stderr, "apply_convolution_ex: Arguments invalides.\n");
+        return NULL;
+    }
+    if (src->channels != 1) {
+        fprintf(stderr, "apply_convolution_ex: Ne supporte que les images en niveaux de gris (1 canal).\n");
+        return NULL;
+    }
+
+    if (engine == CONV_ENGINE_AUTO) {
+        engine = convolution_select_engine(src, kernel);
+    }
+    switch (engine) {
+        case CONV_ENGINE_SEPARABLE:
+            if (kernel_is_separable(kernel, NULL, NULL)) {
+                return _convolve_separable(src, kernel);
+            }
+            fprintf(stderr, "apply_convolution_ex: Noyau non séparable, calcul spatial.\n");
+            return apply_convolution(src, kernel);
+        case CONV_ENGINE_FFT:
+            return _convolve_fft(src, kernel);
+        default:
+            return apply_convolution(src, kernel);
+    }
+}
+
+// --- Chargement d'un noyau depuis un fichier texte ---
+
+Kernel *load_kernel(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "load_kernel: Impossible d'ouvrir '%s'.\n", path);
+        return NULL;
+    }
+
+    int width, height;
+    if (fscanf(f, "%d %d", &width, &height) != 2 || width <= 0 || height <= 0) {
+        fprintf(stderr, "load_kernel: En-tête invalide dans '%s' (largeur hauteur attendues).\n", path);
+        fclose(f);
+        return NULL;
+    }
+
+    Kernel *kernel = malloc(sizeof(Kernel));
+    if (!kernel) {
+        fclose(f);
+        return NULL;
+    }
+    kernel->width = width;
+    kernel->height = height;
+    kernel->data = malloc((size_t)width * height * sizeof(float));
+    if (!kernel->data) {
+        free(kernel);
+        fclose(f);
+        return NULL;
+    }
+
+    for (int i = 0; i < width * height; i++) {
+        if (fscanf(f, "%f", &kernel->data[i]) != 1) {
+            fprintf(stderr, "load_kernel: '%s' contient moins de %d coefficients.\n", path, width * height);
+            free_kernel(kernel);
+            fclose(f);
+            return NULL;
+        }
+    }
+    fclose(f);
+    return kernel;
+}
+
+void free_kernel(Kernel *kernel) {
+    if (kernel) {
+        free(kernel->data);
+        free(kernel);
+    }
+}
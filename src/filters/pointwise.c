@@ -73,6 +73,26 @@ void apply_threshold(Image *img, uint8_t threshold) {
     printf("Seuillage appliqué avec le seuil %d.\n", threshold);
 }
 
+void apply_multi_threshold(Image *img, const int *thresholds, int num_thresholds) {
+    if (!img || !img->data || img->channels != 1 || !thresholds || num_thresholds < 1) {
+        fprintf(stderr, "apply_multi_threshold: Arguments invalides.\n");
+        return;
+    }
+
+    uint8_t lut[256];
+    int c = 0;
+    for (int v = 0; v < 256; v++) {
+        while (c < num_thresholds && thresholds[c] <= v) c++;
+        lut[v] = (uint8_t)((c * 255 + num_thresholds / 2) / num_thresholds);
+    }
+
+    long total_pixels = (long)img->width * img->height;
+    for (long i = 0; i < total_pixels; i++) {
+        img->data[i] = lut[img->data[i]];
+    }
+
+    printf("Quantification appliquée en %d niveaux.\n", num_thresholds + 1);
+}
 
 void apply_gamma_correction(Image *img, double gamma) {
     if (!img || !img->data) return;
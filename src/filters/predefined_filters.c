@@ -1,5 +1,6 @@
 #include "filters/predefined_filters.h"
 #include "filters/convolution.h" // On a besoin de la structure Kernel et de apply_convolution
+#include "core/parallel.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h> 
@@ -203,6 +204,50 @@ Image *apply_sobel_filter(const Image *src) {
     return _apply_gradient_filter(src, &kernel_x, &kernel_y);
 }
 
+GradientField *compute_sobel_gradient(const Image *src) {
+    if (!src || !src->data || src->channels != 1) {
+        fprintf(stderr, "compute_sobel_gradient: Ne supporte que les images en niveaux de gris (1 canal).\n");
+        return NULL;
+    }
+    int w = src->width;
+    int h = src->height;
+
+    GradientField *field = malloc(sizeof(GradientField));
+    if (!field) return NULL;
+    field->width = w;
+    field->height = h;
+    field->gx = malloc((size_t)w * h * sizeof(float));
+    field->gy = malloc((size_t)w * h * sizeof(float));
+    if (!field->gx || !field->gy) {
+        free_gradient_field(field);
+        return NULL;
+    }
+
+    for (int y = 0; y < h; y++) {
+        // Lignes voisines, bords répétés (comme apply_convolution)
+        const uint8_t *up = src->data + (size_t)(y > 0 ? y - 1 : 0) * w;
+        const uint8_t *mid = src->data + (size_t)y * w;
+        const uint8_t *down = src->data + (size_t)(y < h - 1 ? y + 1 : h - 1) * w;
+        for (int x = 0; x < w; x++) {
+            int xl = x > 0 ? x - 1 : 0;
+            int xr = x < w - 1 ? x + 1 : w - 1;
+            int gx = (up[xr] - up[xl]) + 2 * (mid[xr] - mid[xl]) + (down[xr] - down[xl]);
+            int gy = (down[xl] + 2 * down[x] + down[xr]) - (up[xl] + 2 * up[x] + up[xr]);
+            field->gx[(size_t)y * w + x] = (float)gx;
+            field->gy[(size_t)y * w + x] = (float)gy;
+        }
+    }
+    return field;
+}
+
+void free_gradient_field(GradientField *field) {
+    if (field) {
+        free(field->gx);
+        free(field->gy);
+        free(field);
+    }
+}
+
 Image *apply_prewitt_filter(const Image *src) {
     float kx_data[] = {-1, 0, 1, -1, 0, 1, -1, 0, 1};
     float ky_data[] = {-1, -1, -1, 0, 0, 0, 1, 1, 1};
@@ -441,4 +486,199 @@ Image *apply_laplacian_filter(const Image *src) {
     // mais pour une détection simple "noir/blanc", le clamping standard suffit souvent
     // à montrer les transitions les plus fortes.
     return apply_convolution(src, &kernel);
-}
\ No newline at end of file
+}
+
+
+// --- Flou Gaussien récursif (Young - van Vliet, 1995) ---
+
+// Coefficients du filtre d'ordre 3 : w[n] = B x[n] + (b1 w[n-1] + b2 w[n-2] + b3 w[n-3]) / b0
+typedef struct {
+    float B;
+    float a1; // b1 / b0
+    float a2; // b2 / b0
+    float a3; // b3 / b0
+} RecursiveGaussCoeffs;
+
+static RecursiveGaussCoeffs _recursive_gauss_coeffs(double sigma) {
+    double q;
+    if (sigma >= 2.5) q = 0.98711 * sigma - 0.96330;
+    else q = 3.97156 - 4.14554 * sqrt(1.0 - 0.26891 * sigma);
+
+    double q2 = q * q;
+    double q3 = q2 * q;
+    double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+    double b1 = 2.44413 * q + 2.85619 * q2 + 1.26661 * q3;
+    double b2 = -(1.4281 * q2 + 1.26661 * q3);
+    double b3 = 0.422205 * q3;
+
+    RecursiveGaussCoeffs c;
+    c.a1 = (float)(b1 / b0);
+    c.a2 = (float)(b2 / b0);
+    c.a3 = (float)(b3 / b0);
+    c.B = 1.0f - (c.a1 + c.a2 + c.a3); // Gain unitaire : une zone uniforme reste intacte
+    return c;
+}
+
+typedef struct {
+    float *buf;      // Image en float, canal par canal (planes plans de width * rows)
+    int width;
+    int height;
+    int rows;        // height + pad : lignes allouées par plan
+    int pad;         // Prolongement du bord droit / bas (voir apply_gaussian_blur_sigma)
+    int planes;
+    RecursiveGaussCoeffs c;
+    float **lines;   // Par thread : ligne prolongée de width + pad floats (passe horizontale)
+} RecursiveGaussContext;
+
+// Passes causale puis anti-causale sur chaque ligne [begin, end) de tous les plans.
+// La passe causale démarre en régime établi sur le premier pixel (bord gauche
+// prolongé à l'infini : c'est exact). À droite, la ligne est prolongée de 'pad'
+// pixels répétés, le temps que la réponse causale converge vers le bord ;
+// la passe anti-causale peut alors démarrer en régime établi.
+static void _recursive_rows_worker(void *arg, int begin, int end, int thread_id) {
+    RecursiveGaussContext *ctx = (RecursiveGaussContext *)arg;
+    RecursiveGaussCoeffs c = ctx->c;
+    int n = ctx->width;
+    int len = n + ctx->pad;
+    float *line = ctx->lines[thread_id];
+
+    for (int p = 0; p < ctx->planes; p++) {
+        for (int y = begin; y < end; y++) {
+            float *row = ctx->buf + ((size_t)p * ctx->rows + y) * n;
+            memcpy(line, row, n * sizeof(float));
+            for (int x = n; x < len; x++) line[x] = row[n - 1];
+
+            float w1 = line[0], w2 = line[0], w3 = line[0];
+            for (int x = 0; x < len; x++) {
+                float w = c.B * line[x] + c.a1 * w1 + c.a2 * w2 + c.a3 * w3;
+                line[x] = w;
+                w3 = w2; w2 = w1; w1 = w;
+            }
+
+            float y1 = line[len - 1], y2 = line[len - 1], y3 = line[len - 1];
+            for (int x = len - 1; x >= 0; x--) {
+                float v = c.B * line[x] + c.a1 * y1 + c.a2 * y2 + c.a3 * y3;
+                line[x] = v;
+                y3 = y2; y2 = y1; y1 = v;
+            }
+            memcpy(row, line, n * sizeof(float));
+        }
+    }
+}
+
+// Même récursion le long des colonnes [begin, end), ligne par ligne : la
+// boucle interne parcourt des colonnes contiguës (accès séquentiels).
+// Les 'pad' lignes sous l'image répètent la dernière ligne.
+static void _recursive_columns_worker(void *arg, int begin, int end, int thread_id) {
+    RecursiveGaussContext *ctx = (RecursiveGaussContext *)arg;
+    (void)thread_id;
+    RecursiveGaussCoeffs c = ctx->c;
+    int w = ctx->width;
+    int h = ctx->rows;
+    size_t count = (size_t)(end - begin) * sizeof(float);
+    for (int p = 0; p < ctx->planes; p++) {
+        float *plane = ctx->buf + (size_t)p * h * w;
+        const float *last = plane + (size_t)(ctx->height - 1) * w + begin;
+        for (int y = ctx->height; y < h; y++) {
+            memcpy(plane + (size_t)y * w + begin, last, count);
+        }
+
+        // Causale : les lignes "avant" la première valent la première ligne.
+        // Au démarrage, r1..r3 désignent la première ligne encore brute,
+        // c'est le régime établi du bord.
+        for (int y = 0; y < h; y++) {
+            float *row = plane + (size_t)y * w;
+            const float *r1 = plane + (size_t)(y >= 1 ? y - 1 : 0) * w;
+            const float *r2 = plane + (size_t)(y >= 2 ? y - 2 : 0) * w;
+            const float *r3 = plane + (size_t)(y >= 3 ? y - 3 : 0) * w;
+            for (int x = begin; x < end; x++) {
+                row[x] = c.B * row[x] + c.a1 * r1[x] + c.a2 * r2[x] + c.a3 * r3[x];
+            }
+        }
+
+        // Anti-causale : les lignes "après" la dernière valent la dernière ligne
+        for (int y = h - 1; y >= 0; y--) {
+            float *row = plane + (size_t)y * w;
+            const float *r1 = plane + (size_t)(y + 1 < h ? y + 1 : h - 1) * w;
+            const float *r2 = plane + (size_t)(y + 2 < h ? y + 2 : h - 1) * w;
+            const float *r3 = plane + (size_t)(y + 3 < h ? y + 3 : h - 1) * w;
+            for (int x = begin; x < end; x++) {
+                row[x] = c.B * row[x] + c.a1 * r1[x] + c.a2 * r2[x] + c.a3 * r3[x];
+            }
+        }
+    }
+}
+
+Image *apply_gaussian_blur_sigma(const Image *src, double sigma) {
+    if (!src || !src->data) {
+        fprintf(stderr, "apply_gaussian_blur_sigma: Image invalide.\n");
+        return NULL;
+    }
+
+    int width = src->width;
+    int height = src->height;
+    int channels = src->channels;
+    Image *dest = createImage(width, height, channels);
+    if (!dest) return NULL;
+    size_t plane_size = (size_t)width * height;
+
+    if (sigma < 0.5) {
+        memcpy(dest->data, src->data, plane_size * channels);
+        return dest;
+    }
+
+    // Prolongement du bord droit / bas : la réponse du filtre causal décroît
+    // en quelques sigma, 6 sigma suffisent à la rendre négligeable (< 0.1 niveau).
+    // Ce coût est par ligne et par colonne, pas par pixel.
+    int pad = (int)ceil(6.0 * sigma) + 3;
+    int rows = height + pad;
+
+    // Plans séparés par canal, en float
+    float *buf = malloc((size_t)width * rows * channels * sizeof(float));
+    if (!buf) {
+        freeImage(dest);
+        return NULL;
+    }
+    for (size_t i = 0; i < plane_size; i++) {
+        for (int ch = 0; ch < channels; ch++) {
+            buf[ch * (size_t)width * rows + i] = src->data[i * channels + ch];
+        }
+    }
+
+    // Lignes de travail de la passe horizontale, allouées avant de lancer les threads
+    int threads = parallel_thread_count(height, 16);
+    float **lines = calloc(threads, sizeof(float *));
+    int ok = lines != NULL;
+    for (int i = 0; ok && i < threads; i++) {
+        lines[i] = malloc((size_t)(width + pad) * sizeof(float));
+        if (!lines[i]) ok = 0;
+    }
+    if (!ok) {
+        fprintf(stderr, "apply_gaussian_blur_sigma: Erreur d'allocation mémoire.\n");
+        for (int i = 0; lines && i < threads; i++) free(lines[i]);
+        free(lines);
+        free(buf);
+        freeImage(dest);
+        return NULL;
+    }
+
+    RecursiveGaussContext ctx = {buf, width, height, rows, pad, channels, _recursive_gauss_coeffs(sigma), lines};
+    parallel_for(height, threads, _recursive_rows_worker, &ctx);
+    for (int i = 0; i < threads; i++) free(lines[i]);
+    free(lines);
+    threads = parallel_thread_count(width, 64);
+    parallel_for(width, threads, _recursive_columns_worker, &ctx);
+
+    for (size_t i = 0; i < plane_size; i++) {
+        for (int ch = 0; ch < channels; ch++) {
+            float v = buf[ch * (size_t)width * rows + i] + 0.5f; // Arrondi au plus proche
+            if (v < 0) v = 0;
+            if (v > 255) v = 255;
+            dest->data[i * channels + ch] = (uint8_t)v;
+        }
+    }
+
+    free(buf);
+    return dest;
+}
+
@@ -0,0 +1,267 @@
+#include "geometry/pyramid.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Noyau binomial [1 4 6 4 1] (somme 16)
+static const int BINOMIAL5[5] = {1, 4, 6, 4, 1};
+
+static inline int _clamp_index(int i, int n) {
+    return i < 0 ? 0 : (i >= n ? n - 1 : i);
+}
+
+// Lissage horizontal et décimation d'une ligne (résultat x16)
+static void _reduce_row(const uint8_t *row, int width, int channels, int out_width, uint16_t *out) {
+    for (int x = 0; x < out_width; x++) {
+        for (int c = 0; c < channels; c++) {
+            int sum = 0;
+            for (int k = 0; k < 5; k++) {
+                sum += BINOMIAL5[k] * row[_clamp_index(2 * x + k - 2, width) * channels + c];
+            }
+            out[x * channels + c] = (uint16_t)sum;
+        }
+    }
+}
+
+Image *pyramid_reduce(const Image *src) {
+    if (!src || !src->data) return NULL;
+    int w = src->width, h = src->height, ch = src->channels;
+    int nw = (w + 1) / 2, nh = (h + 1) / 2;
+    int row_len = nw * ch;
+
+    Image *dest = createImage(nw, nh, ch);
+    uint16_t *ring = malloc(5 * (size_t)row_len * sizeof(uint16_t));
+    if (!dest || !ring) {
+        freeImage(dest);
+        free(ring);
+        return NULL;
+    }
+
+    // Anneau : la ligne source y (bornée) occupe la case y mod 5
+    int held[5] = {-1, -1, -1, -1, -1};
+    for (int y = 0; y < nh; y++) {
+        const uint16_t *rows[5];
+        for (int k = 0; k < 5; k++) {
+            int sy = _clamp_index(2 * y + k - 2, h);
+            int slot = sy % 5;
+            if (held[slot] != sy) {
+                _reduce_row(src->data + (size_t)sy * w * ch, w, ch, nw, ring + (size_t)slot * row_len);
+                held[slot] = sy;
+            }
+            rows[k] = ring + (size_t)slot * row_len;
+        }
+        uint8_t *out = dest->data + (size_t)y * row_len;
+        for (int i = 0; i < row_len; i++) {
+            int sum = rows[0][i] + 4 * rows[1][i] + 6 * rows[2][i] + 4 * rows[3][i] + rows[4][i];
+            out[i] = (uint8_t)((sum + 128) >> 8);
+        }
+    }
+    free(ring);
+    return dest;
+}
+
+// EXPAND sur un axe : pair 2m -> (g[m-1] + 6 g[m] + g[m+1]), impair 2m+1 -> 4 (g[m] + g[m+1]) (x8)
+static void _expand_row(const uint8_t *row, int width, int channels, int out_width, uint16_t *out) {
+    for (int x = 0; x < out_width; x++) {
+        int m = x / 2;
+        for (int c = 0; c < channels; c++) {
+            int sum;
+            if (x % 2 == 0) {
+                sum = row[_clamp_index(m - 1, width) * channels + c] + 6 * row[m * channels + c] +
+                      row[_clamp_index(m + 1, width) * channels + c];
+            } else {
+                sum = 4 * (row[m * channels + c] + row[_clamp_index(m + 1, width) * channels + c]);
+            }
+            out[x * channels + c] = (uint16_t)sum;
+        }
+    }
+}
+
+Image *pyramid_expand(const Image *src, int width, int height) {
+    if (!src || !src->data || width <= 0 || height <= 0 ||
+        (width + 1) / 2 != src->width || (height + 1) / 2 != src->height) {
+        fprintf(stderr, "pyramid_expand: Dimensions cibles incompatibles.\n");
+        return NULL;
+    }
+    int ch = src->channels;
+    int row_len = width * ch;
+
+    Image *dest = createImage(width, height, ch);
+    uint16_t *rows = malloc(src->height * (size_t)row_len * sizeof(uint16_t));
+    if (!dest || !rows) {
+        freeImage(dest);
+        free(rows);
+        return NULL;
+    }
+    for (int y = 0; y < src->height; y++) {
+        _expand_row(src->data + (size_t)y * src->width * ch, src->width, ch, width, rows + (size_t)y * row_len);
+    }
+    for (int y = 0; y < height; y++) {
+        int m = y / 2;
+        const uint16_t *r0 = rows + (size_t)_clamp_index(m - 1, src->height) * row_len;
+        const uint16_t *r1 = rows + (size_t)m * row_len;
+        const uint16_t *r2 = rows + (size_t)_clamp_index(m + 1, src->height) * row_len;
+        uint8_t *out = dest->data + (size_t)y * row_len;
+        for (int i = 0; i < row_len; i++) {
+            int sum = y % 2 == 0 ? r0[i] + 6 * r1[i] + r2[i] : 4 * (r1[i] + r2[i]);
+            out[i] = (uint8_t)((sum + 32) >> 6);
+        }
+    }
+    free(rows);
+    return dest;
+}
+
+static ImagePyramid *_pyramid_create(int num_levels) {
+    ImagePyramid *pyramid = malloc(sizeof(ImagePyramid));
+    if (!pyramid) return NULL;
+    pyramid->levels = calloc(num_levels, sizeof(Image *));
+    if (!pyramid->levels) {
+        free(pyramid);
+        return NULL;
+    }
+    pyramid->num_levels = 0;
+    return pyramid;
+}
+
+void free_pyramid(ImagePyramid *pyramid) {
+    if (!pyramid) return;
+    for (int i = 0; i < pyramid->num_levels; i++) freeImage(pyramid->levels[i]);
+    free(pyramid->levels);
+    free(pyramid);
+}
+
+static void _free_detail(DetailImage *detail) {
+    if (!detail) return;
+    free(detail->data);
+    free(detail);
+}
+
+void free_laplacian_pyramid(LaplacianPyramid *pyramid) {
+    if (!pyramid) return;
+    for (int i = 0; i < pyramid->num_levels - 1; i++) _free_detail(pyramid->details[i]);
+    free(pyramid->details);
+    freeImage(pyramid->residual);
+    free(pyramid);
+}
+
+// Détails G(i) - EXPAND(G(i+1)), sans borne
+static DetailImage *_make_detail(const Image *fine, const Image *coarse) {
+    Image *up = pyramid_expand(coarse, fine->width, fine->height);
+    if (!up) return NULL;
+    DetailImage *detail = malloc(sizeof(DetailImage));
+    size_t n = (size_t)fine->width * fine->height * fine->channels;
+    if (detail) detail->data = malloc(n * sizeof(int16_t));
+    if (!detail || !detail->data) {
+        free(detail);
+        freeImage(up);
+        return NULL;
+    }
+    detail->width = fine->width;
+    detail->height = fine->height;
+    detail->channels = fine->channels;
+    for (size_t i = 0; i < n; i++) detail->data[i] = (int16_t)(fine->data[i] - up->data[i]);
+    freeImage(up);
+    return detail;
+}
+
+static Image *_copy_image(const Image *src) {
+    Image *copy = createImage(src->width, src->height, src->channels);
+    if (copy) memcpy(copy->data, src->data, (size_t)src->width * src->height * src->channels);
+    return copy;
+}
+
+int build_pyramids(const Image *src, int num_levels, ImagePyramid **gaussian, LaplacianPyramid **laplacian) {
+    if (!src || !src->data || num_levels < 1 || (!gaussian && !laplacian)) {
+        fprintf(stderr, "build_pyramids: Arguments invalides.\n");
+        return -1;
+    }
+    ImagePyramid *gauss = gaussian ? _pyramid_create(num_levels) : NULL;
+    LaplacianPyramid *lap = laplacian ? calloc(1, sizeof(LaplacianPyramid)) : NULL;
+    if (lap) lap->details = calloc(num_levels, sizeof(DetailImage *));
+    Image *current = _copy_image(src);
+    if ((gaussian && !gauss) || (laplacian && (!lap || !lap->details)) || !current) {
+        free_pyramid(gauss);
+        if (lap) free(lap->details);
+        free(lap);
+        freeImage(current);
+        return -1;
+    }
+    if (lap) lap->num_levels = 1; // Aucun détail tant que le résidu n'est pas posé
+
+    int level = 0;
+    while (current) {
+        int last = level == num_levels - 1 || (current->width == 1 && current->height == 1);
+        Image *next = last ? NULL : pyramid_reduce(current);
+        DetailImage *detail = (lap && next) ? _make_detail(current, next) : NULL;
+        Image *residual = (lap && last) ? (gauss ? _copy_image(current) : current) : NULL;
+        if ((!last && !next) || (lap && next && !detail) || (lap && last && !residual)) {
+            freeImage(next);
+            _free_detail(detail);
+            freeImage(current);
+            free_pyramid(gauss);
+            free_laplacian_pyramid(lap);
+            return -1;
+        }
+        if (lap) {
+            if (detail) {
+                lap->details[lap->num_levels - 1] = detail;
+                lap->num_levels++;
+            } else {
+                lap->residual = residual;
+            }
+        }
+        // Le niveau gaussien est conservé, ou libéré s'il n'a servi qu'aux détails
+        if (gauss) gauss->levels[gauss->num_levels++] = current;
+        else if (current != residual) freeImage(current);
+        current = next;
+        level++;
+    }
+
+    if (gaussian) *gaussian = gauss;
+    if (laplacian) *laplacian = lap;
+    return 0;
+}
+
+ImagePyramid *build_gaussian_pyramid(const Image *src, int num_levels) {
+    ImagePyramid *gaussian = NULL;
+    if (build_pyramids(src, num_levels, &gaussian, NULL) != 0) return NULL;
+    return gaussian;
+}
+
+LaplacianPyramid *build_laplacian_pyramid(const Image *src, int num_levels) {
+    LaplacianPyramid *laplacian = NULL;
+    if (build_pyramids(src, num_levels, NULL, &laplacian) != 0) return NULL;
+    return laplacian;
+}
+
+Image *pyramid_collapse(const LaplacianPyramid *pyramid) {
+    if (!pyramid || !pyramid->residual) return NULL;
+    Image *current = _copy_image(pyramid->residual);
+    for (int i = pyramid->num_levels - 2; i >= 0 && current; i--) {
+        const DetailImage *detail = pyramid->details[i];
+        Image *up = pyramid_expand(current, detail->width, detail->height);
+        freeImage(current);
+        current = up;
+        if (!current) break;
+        size_t n = (size_t)detail->width * detail->height * detail->channels;
+        for (size_t k = 0; k < n; k++) {
+            int v = current->data[k] + detail->data[k];
+            current->data[k] = (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+        }
+    }
+    return current;
+}
+
+Image *laplacian_level_to_image(const LaplacianPyramid *pyramid, int level) {
+    if (!pyramid || level < 0 || level >= pyramid->num_levels) return NULL;
+    if (level == pyramid->num_levels - 1) return _copy_image(pyramid->residual);
+    const DetailImage *detail = pyramid->details[level];
+    Image *img = createImage(detail->width, detail->height, detail->channels);
+    if (!img) return NULL;
+    size_t n = (size_t)detail->width * detail->height * detail->channels;
+    for (size_t i = 0; i < n; i++) {
+        int v = detail->data[i] + 128;
+        img->data[i] = (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+    }
+    return img;
+}
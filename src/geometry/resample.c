@@ -0,0 +1,338 @@
+#include "geometry/resample.h"
+#include "core/cpu.h"
+#include "core/parallel.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RESAMPLE_X86 1
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Nombre de tables d'axe gardées en cache
+#define RESAMPLE_CACHE_SIZE 16
+
+// --- Partie 1 : Tables de poids ---
+
+typedef struct {
+    int src_size;
+    int dst_size;
+    ResampleFilter filter;
+    int taps;        // Nombre de poids par sortie (identique pour toutes, complété par des zéros)
+    int *index;      // dst_size * taps indices sources (bornés)
+    float *weights;  // dst_size * taps poids (somme 1 par sortie)
+} ResampleAxis;
+
+static double _kernel(ResampleFilter filter, double x) {
+    x = fabs(x);
+    if (filter == RESAMPLE_BICUBIC) {
+        const double a = -0.5;
+        if (x < 1.0) return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+        if (x < 2.0) return (((x - 5.0) * x + 8.0) * x - 4.0) * a;
+        return 0.0;
+    }
+    if (x < 1e-8) return 1.0;
+    if (x >= 3.0) return 0.0;
+    double px = M_PI * x;
+    return 3.0 * sin(px) * sin(px / 3.0) / (px * px);
+}
+
+static ResampleAxis *_axis_create(int src_size, int dst_size, ResampleFilter filter) {
+    double scale = (double)src_size / dst_size;
+    double filter_scale = scale > 1.0 ? scale : 1.0; // En réduction, le noyau s'élargit
+    double support = (filter == RESAMPLE_BICUBIC ? 2.0 : 3.0) * filter_scale;
+    // Entiers de [centre - support, centre + support] : au plus ceil(2 * support) de poids non nul
+    int taps = (int)ceil(2.0 * support - 1e-9);
+
+    ResampleAxis *axis = malloc(sizeof(ResampleAxis));
+    if (!axis) return NULL;
+    axis->src_size = src_size;
+    axis->dst_size = dst_size;
+    axis->filter = filter;
+    axis->taps = taps;
+    axis->index = malloc((size_t)dst_size * taps * sizeof(int));
+    axis->weights = malloc((size_t)dst_size * taps * sizeof(float));
+    if (!axis->index || !axis->weights) {
+        free(axis->index);
+        free(axis->weights);
+        free(axis);
+        return NULL;
+    }
+
+    for (int d = 0; d < dst_size; d++) {
+        double center = (d + 0.5) * scale - 0.5;
+        int left = (int)ceil(center - support);
+        int *idx = axis->index + (size_t)d * taps;
+        float *w = axis->weights + (size_t)d * taps;
+        double total = 0.0;
+        for (int j = 0; j < taps; j++) {
+            int i = left + j;
+            total += _kernel(filter, (i - center) / filter_scale);
+            idx[j] = i < 0 ? 0 : (i >= src_size ? src_size - 1 : i);
+        }
+        for (int j = 0; j < taps; j++) {
+            w[j] = (float)(_kernel(filter, (left + j - center) / filter_scale) / total);
+        }
+    }
+    return axis;
+}
+
+static void _axis_free(ResampleAxis *axis) {
+    if (!axis) return;
+    free(axis->index);
+    free(axis->weights);
+    free(axis);
+}
+
+// Cache : les tables sont immuables une fois créées ; refs compte les
+// utilisateurs en cours pour ne jamais libérer une table utilisée.
+static struct {
+    pthread_mutex_t lock;
+    ResampleAxis *axes[RESAMPLE_CACHE_SIZE];
+    int refs[RESAMPLE_CACHE_SIZE];
+    unsigned long last_use[RESAMPLE_CACHE_SIZE];
+    unsigned long clock;
+} cache = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+// Retourne une table (du cache si possible). *slot reçoit sa case, ou -1 si hors cache.
+static ResampleAxis *_axis_acquire(int src_size, int dst_size, ResampleFilter filter, int *slot) {
+    pthread_mutex_lock(&cache.lock);
+    cache.clock++;
+    for (int i = 0; i < RESAMPLE_CACHE_SIZE; i++) {
+        ResampleAxis *a = cache.axes[i];
+        if (a && a->src_size == src_size && a->dst_size == dst_size && a->filter == filter) {
+            cache.refs[i]++;
+            cache.last_use[i] = cache.clock;
+            pthread_mutex_unlock(&cache.lock);
+            *slot = i;
+            return a;
+        }
+    }
+    pthread_mutex_unlock(&cache.lock);
+
+    ResampleAxis *axis = _axis_create(src_size, dst_size, filter);
+    *slot = -1;
+    if (!axis) return NULL;
+
+    // Ranger la table dans une case libre, ou à la place de la moins récente non utilisée
+    pthread_mutex_lock(&cache.lock);
+    int victim = -1;
+    for (int i = 0; i < RESAMPLE_CACHE_SIZE; i++) {
+        if (cache.refs[i] > 0) continue;
+        if (!cache.axes[i]) { victim = i; break; }
+        if (victim < 0 || cache.last_use[i] < cache.last_use[victim]) victim = i;
+    }
+    if (victim >= 0) {
+        _axis_free(cache.axes[victim]);
+        cache.axes[victim] = axis;
+        cache.refs[victim] = 1;
+        cache.last_use[victim] = cache.clock;
+        *slot = victim;
+    }
+    pthread_mutex_unlock(&cache.lock);
+    return axis;
+}
+
+static void _axis_release(ResampleAxis *axis, int slot) {
+    if (slot < 0) {
+        _axis_free(axis);
+        return;
+    }
+    pthread_mutex_lock(&cache.lock);
+    cache.refs[slot]--;
+    pthread_mutex_unlock(&cache.lock);
+}
+
+void resample_cache_clear(void) {
+    pthread_mutex_lock(&cache.lock);
+    for (int i = 0; i < RESAMPLE_CACHE_SIZE; i++) {
+        if (cache.axes[i] && cache.refs[i] == 0) {
+            _axis_free(cache.axes[i]);
+            cache.axes[i] = NULL;
+        }
+    }
+    pthread_mutex_unlock(&cache.lock);
+}
+
+// --- Partie 2 : Accumulation verticale vectorisée ---
+// acc[i] += w * row[i] ; les trois versions font les mêmes opérations (mul puis add).
+
+typedef void (*AccumulateFn)(float *acc, const float *row, float w, int count);
+
+static void _accumulate_scalar(float *acc, const float *row, float w, int count) {
+    for (int i = 0; i < count; i++) acc[i] = acc[i] + row[i] * w;
+}
+
+#if defined(RESAMPLE_X86) && defined(__SSE2__)
+static void _accumulate_sse2(float *acc, const float *row, float w, int count) {
+    __m128 vw = _mm_set1_ps(w);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 a = _mm_loadu_ps(acc + i);
+        _mm_storeu_ps(acc + i, _mm_add_ps(a, _mm_mul_ps(_mm_loadu_ps(row + i), vw)));
+    }
+    _accumulate_scalar(acc + i, row + i, w, count - i);
+}
+#endif
+
+#ifdef RESAMPLE_X86
+__attribute__((target("avx2")))
+static void _accumulate_avx2(float *acc, const float *row, float w, int count) {
+    __m256 vw = _mm256_set1_ps(w);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 a = _mm256_loadu_ps(acc + i);
+        _mm256_storeu_ps(acc + i, _mm256_add_ps(a, _mm256_mul_ps(_mm256_loadu_ps(row + i), vw)));
+    }
+    _mm256_zeroupper();
+    _accumulate_scalar(acc + i, row + i, w, count - i);
+}
+#endif
+
+// Conversion de l'accumulateur en octets : arrondi puis bornage à [0, 255]
+typedef void (*StoreFn)(const float *acc, uint8_t *out, int count);
+
+static void _store_scalar(const float *acc, uint8_t *out, int count) {
+    for (int i = 0; i < count; i++) {
+        float v = acc[i] + 0.5f;
+        out[i] = v <= 0.0f ? 0 : (v >= 255.0f ? 255 : (uint8_t)v);
+    }
+}
+
+#if defined(RESAMPLE_X86) && defined(__SSE2__)
+static void _store_sse2(const float *acc, uint8_t *out, int count) {
+    __m128 half = _mm_set1_ps(0.5f), lo = _mm_setzero_ps(), hi = _mm_set1_ps(255.0f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128 a = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_loadu_ps(acc + i), half), lo), hi);
+        __m128 b = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_loadu_ps(acc + i + 4), half), lo), hi);
+        __m128i packed = _mm_packs_epi32(_mm_cvttps_epi32(a), _mm_cvttps_epi32(b));
+        _mm_storel_epi64((__m128i *)(out + i), _mm_packus_epi16(packed, packed));
+    }
+    _store_scalar(acc + i, out + i, count - i);
+}
+#endif
+
+typedef struct {
+    AccumulateFn accumulate;
+    StoreFn store;
+} ResampleKernels;
+
+static ResampleKernels _select_kernels(void) {
+    ResampleKernels k = {_accumulate_scalar, _store_scalar};
+    SimdLevel level = cpu_simd_level();
+#if defined(RESAMPLE_X86) && defined(__SSE2__)
+    if (level >= SIMD_SSE2) {
+        k.accumulate = _accumulate_sse2;
+        k.store = _store_sse2;
+    }
+#endif
+#ifdef RESAMPLE_X86
+    if (level >= SIMD_AVX2) k.accumulate = _accumulate_avx2;
+#endif
+    (void)level;
+    return k;
+}
+
+// --- Partie 3 : Passes ---
+
+typedef struct {
+    const Image *src;
+    Image *dest;
+    const ResampleAxis *ax;
+    const ResampleAxis *ay;
+    float *tmp;          // Passe horizontale : src->height lignes de new_width * ch flottants
+    float **buffers;     // Par thread : ligne source convertie (passe 1) ou accumulateur (passe 2)
+    ResampleKernels kernels;
+} ResampleContext;
+
+static void _horizontal_rows(void *ctx, int begin, int end, int thread_id) {
+    ResampleContext *c = ctx;
+    int ch = c->src->channels;
+    int sw = c->src->width;
+    int dw = c->dest->width;
+    int taps = c->ax->taps;
+    float *line = c->buffers[thread_id];
+
+    for (int y = begin; y < end; y++) {
+        const uint8_t *row = c->src->data + (size_t)y * sw * ch;
+        for (int i = 0; i < sw * ch; i++) line[i] = row[i];
+        float *out = c->tmp + (size_t)y * dw * ch;
+        for (int x = 0; x < dw; x++) {
+            const int *idx = c->ax->index + (size_t)x * taps;
+            const float *w = c->ax->weights + (size_t)x * taps;
+            for (int k = 0; k < ch; k++) {
+                float sum = 0.0f;
+                for (int j = 0; j < taps; j++) sum += w[j] * line[idx[j] * ch + k];
+                out[x * ch + k] = sum;
+            }
+        }
+    }
+}
+
+static void _vertical_rows(void *ctx, int begin, int end, int thread_id) {
+    ResampleContext *c = ctx;
+    int row_len = c->dest->width * c->dest->channels;
+    int taps = c->ay->taps;
+    float *acc = c->buffers[thread_id];
+
+    for (int y = begin; y < end; y++) {
+        const int *idx = c->ay->index + (size_t)y * taps;
+        const float *w = c->ay->weights + (size_t)y * taps;
+        memset(acc, 0, row_len * sizeof(float));
+        for (int j = 0; j < taps; j++) {
+            if (w[j] == 0.0f) continue;
+            c->kernels.accumulate(acc, c->tmp + (size_t)idx[j] * row_len, w[j], row_len);
+        }
+        c->kernels.store(acc, c->dest->data + (size_t)y * row_len, row_len);
+    }
+}
+
+Image *resize_resample(const Image *src, int new_width, int new_height, ResampleFilter filter) {
+    if (!src || !src->data || new_width <= 0 || new_height <= 0) return NULL;
+    int ch = src->channels;
+
+    Image *dest = createImage(new_width, new_height, ch);
+    int slot_x, slot_y;
+    ResampleAxis *ax = _axis_acquire(src->width, new_width, filter, &slot_x);
+    ResampleAxis *ay = _axis_acquire(src->height, new_height, filter, &slot_y);
+    float *tmp = malloc((size_t)src->height * new_width * ch * sizeof(float));
+
+    int threads_h = parallel_thread_count(src->height, 8);
+    int threads_v = parallel_thread_count(new_height, 8);
+    int num_buffers = threads_h > threads_v ? threads_h : threads_v;
+    size_t buffer_len = (size_t)(src->width > new_width ? src->width : new_width) * ch;
+    float **buffers = calloc(num_buffers, sizeof(float *));
+    int ok = dest && ax && ay && tmp && buffers;
+    for (int i = 0; ok && i < num_buffers; i++) {
+        buffers[i] = malloc(buffer_len * sizeof(float));
+        if (!buffers[i]) ok = 0;
+    }
+
+    if (ok) {
+        ResampleContext c = {src, dest, ax, ay, tmp, buffers, _select_kernels()};
+        parallel_for(src->height, threads_h, _horizontal_rows, &c);
+        parallel_for(new_height, threads_v, _vertical_rows, &c);
+    }
+
+    for (int i = 0; buffers && i < num_buffers; i++) free(buffers[i]);
+    free(buffers);
+    free(tmp);
+    if (ax) _axis_release(ax, slot_x);
+    if (ay) _axis_release(ay, slot_y);
+    if (!ok) {
+        freeImage(dest);
+        return NULL;
+    }
+
+    printf("Redimensionnement (%s) : %dx%d -> %dx%d\n", filter == RESAMPLE_BICUBIC ? "Bicubique" : "Lanczos-3",
+           src->width, src->height, new_width, new_height);
+    return dest;
+}
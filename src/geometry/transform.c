@@ -1,8 +1,17 @@
 #include "geometry/transform.h"
+#include "core/cpu.h"
+#include "core/parallel.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <stddef.h>
+#include <string.h>
 #include <math.h>  
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TRANSFORM_X86 1
+#endif
+
 Image *resize_nearest_neighbor(const Image *src, int new_width, int new_height) {
     if (!src || new_width <= 0 || new_height <= 0) return NULL;
 
@@ -36,109 +45,846 @@ Image *resize_nearest_neighbor(const Image *src, int new_width, int new_height)
     return dest;
 }
 
+// --- Redimensionnement bilinéaire en virgule fixe ---
+//
+// Les positions sources ne dépendent que de x (pour les colonnes) ou de y
+// (pour les lignes) : elles sont tabulées une fois, avec des poids sur 8 bits
+// (Q8). Chaque ligne source utile est interpolée horizontalement une seule
+// fois dans un petit anneau de deux lignes (valeurs Q8 sur 16 bits), puis
+// chaque ligne de sortie est la combinaison verticale de deux lignes de
+// l'anneau, vectorisée en SSE2 ou AVX2. Les calculs sont entiers et exacts :
+// le résultat ne dépend pas du CPU.
+
+#define BILINEAR_BITS 8
+#define BILINEAR_ONE (1 << BILINEAR_BITS)
+
+typedef struct {
+    int *x0, *x1;   // Décalages (en éléments, canaux compris) des deux colonnes sources
+    uint16_t *wx;   // Poids Q8 de la colonne x1
+    int *y0, *y1;   // Lignes sources de chaque ligne de sortie
+    uint16_t *wy;   // Poids Q8 de la ligne y1
+} BilinearTables;
+
+// Tables d'un axe : même convention de centrage que l'ancienne version (pixel centré, bords répliqués)
+static void _bilinear_axis(int src_size, int dst_size, int stride, int *i0, int *i1, uint16_t *w) {
+    float scale = (float)src_size / dst_size;
+    for (int d = 0; d < dst_size; d++) {
+        float pos = (d + 0.5f) * scale - 0.5f;
+        int p0 = (int)floorf(pos);
+        int weight = (int)lrintf((pos - p0) * BILINEAR_ONE);
+        if (weight == BILINEAR_ONE) { p0++; weight = 0; }
+        int p1 = p0 + 1;
+        if (p0 < 0) p0 = 0;
+        if (p0 > src_size - 1) p0 = src_size - 1;
+        if (p1 < 0) p1 = 0;
+        if (p1 > src_size - 1) p1 = src_size - 1;
+        i0[d] = p0 * stride;
+        i1[d] = p1 * stride;
+        w[d] = (uint16_t)weight;
+    }
+}
+
+// Interpolation horizontale d'une ligne source (résultat Q8, <= 255 * 256)
+static void _bilinear_hrow(const uint8_t *src_row, const BilinearTables *t, int dst_width, int channels,
+                           uint16_t *out) {
+    if (channels == 1) {
+        for (int x = 0; x < dst_width; x++) {
+            int w = t->wx[x];
+            out[x] = (uint16_t)(src_row[t->x0[x]] * (BILINEAR_ONE - w) + src_row[t->x1[x]] * w);
+        }
+        return;
+    }
+    for (int x = 0; x < dst_width; x++) {
+        const uint8_t *p0 = src_row + t->x0[x];
+        const uint8_t *p1 = src_row + t->x1[x];
+        int w = t->wx[x];
+        for (int c = 0; c < channels; c++) {
+            out[x * channels + c] = (uint16_t)(p0[c] * (BILINEAR_ONE - w) + p1[c] * w);
+        }
+    }
+}
+
+// Combinaison verticale de deux lignes Q8 : (r0 * w0 + r1 * w1 + 2^15) >> 16
+typedef void (*BilinearVRowFn)(const uint16_t *r0, const uint16_t *r1, int w0, int w1, uint8_t *dst, int count);
+
+static void _bilinear_vrow_scalar(const uint16_t *r0, const uint16_t *r1, int w0, int w1, uint8_t *dst, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = (uint8_t)(((uint32_t)r0[i] * w0 + (uint32_t)r1[i] * w1 + (1u << 15)) >> 16);
+    }
+}
+
+#if defined(TRANSFORM_X86) && defined(__SSE2__)
+static void _bilinear_vrow_sse2(const uint16_t *r0, const uint16_t *r1, int w0, int w1, uint8_t *dst, int count) {
+    __m128i vw0 = _mm_set1_epi16((short)w0), vw1 = _mm_set1_epi16((short)w1);
+    __m128i round = _mm_set1_epi32(1 << 15);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(r0 + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(r1 + i));
+        // Produits 16 x 16 -> 32 bits exacts (parties basses et hautes)
+        __m128i alo = _mm_mullo_epi16(a, vw0), ahi = _mm_mulhi_epu16(a, vw0);
+        __m128i blo = _mm_mullo_epi16(b, vw1), bhi = _mm_mulhi_epu16(b, vw1);
+        __m128i s_lo = _mm_add_epi32(_mm_unpacklo_epi16(alo, ahi), _mm_unpacklo_epi16(blo, bhi));
+        __m128i s_hi = _mm_add_epi32(_mm_unpackhi_epi16(alo, ahi), _mm_unpackhi_epi16(blo, bhi));
+        s_lo = _mm_srli_epi32(_mm_add_epi32(s_lo, round), 16);
+        s_hi = _mm_srli_epi32(_mm_add_epi32(s_hi, round), 16);
+        __m128i packed = _mm_packs_epi32(s_lo, s_hi);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(packed, packed));
+    }
+    _bilinear_vrow_scalar(r0 + i, r1 + i, w0, w1, dst + i, count - i);
+}
+#endif
+
+#ifdef TRANSFORM_X86
+__attribute__((target("avx2")))
+static void _bilinear_vrow_avx2(const uint16_t *r0, const uint16_t *r1, int w0, int w1, uint8_t *dst, int count) {
+    __m256i vw0 = _mm256_set1_epi16((short)w0), vw1 = _mm256_set1_epi16((short)w1);
+    __m256i round = _mm256_set1_epi32(1 << 15);
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(r0 + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(r1 + i));
+        __m256i alo = _mm256_mullo_epi16(a, vw0), ahi = _mm256_mulhi_epu16(a, vw0);
+        __m256i blo = _mm256_mullo_epi16(b, vw1), bhi = _mm256_mulhi_epu16(b, vw1);
+        // unpack et pack travaillent par moitiés de 128 bits : l'ordre est conservé dans chaque moitié
+        __m256i s_lo = _mm256_add_epi32(_mm256_unpacklo_epi16(alo, ahi), _mm256_unpacklo_epi16(blo, bhi));
+        __m256i s_hi = _mm256_add_epi32(_mm256_unpackhi_epi16(alo, ahi), _mm256_unpackhi_epi16(blo, bhi));
+        s_lo = _mm256_srli_epi32(_mm256_add_epi32(s_lo, round), 16);
+        s_hi = _mm256_srli_epi32(_mm256_add_epi32(s_hi, round), 16);
+        __m256i packed = _mm256_packs_epi32(s_lo, s_hi);
+        packed = _mm256_packus_epi16(packed, packed);
+        // Octets utiles dans les mots 64 bits 0 et 2
+        packed = _mm256_permute4x64_epi64(packed, 0x08);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm256_castsi256_si128(packed));
+    }
+    _mm256_zeroupper();
+    _bilinear_vrow_scalar(r0 + i, r1 + i, w0, w1, dst + i, count - i);
+}
+#endif
+
+static BilinearVRowFn _select_bilinear_vrow(void) {
+    SimdLevel level = cpu_simd_level();
+#ifdef TRANSFORM_X86
+    if (level >= SIMD_AVX2) return _bilinear_vrow_avx2;
+#endif
+#if defined(TRANSFORM_X86) && defined(__SSE2__)
+    if (level >= SIMD_SSE2) return _bilinear_vrow_sse2;
+#endif
+    (void)level;
+    return _bilinear_vrow_scalar;
+}
+
+typedef struct {
+    const Image *src;
+    Image *dest;
+    const BilinearTables *tables;
+    BilinearVRowFn vrow;
+    uint16_t **rings;   // Anneau de deux lignes horizontales par thread
+} BilinearContext;
+
+static void _bilinear_rows(void *ctx, int begin, int end, int thread_id) {
+    BilinearContext *c = ctx;
+    const Image *src = c->src;
+    int dst_width = c->dest->width;
+    int ch = src->channels;
+    int row_len = dst_width * ch;
+    size_t src_stride = (size_t)src->width * ch;
+    uint16_t *slots[2] = {c->rings[thread_id], c->rings[thread_id] + row_len};
+    int held[2] = {-1, -1}; // Ligne source contenue dans chaque case de l'anneau
+
+    for (int y = begin; y < end; y++) {
+        int sy[2] = {c->tables->y0[y], c->tables->y1[y]};
+        const uint16_t *rows[2];
+        for (int k = 0; k < 2; k++) {
+            int slot = held[0] == sy[k] ? 0 : held[1] == sy[k] ? 1 : -1;
+            if (slot < 0) {
+                // Remplacer la case qui ne contient pas l'autre ligne nécessaire
+                slot = held[0] == sy[1 - k] ? 1 : 0;
+                _bilinear_hrow(src->data + sy[k] * src_stride, c->tables, dst_width, ch, slots[slot]);
+                held[slot] = sy[k];
+            }
+            rows[k] = slots[slot];
+        }
+        int wy = c->tables->wy[y];
+        c->vrow(rows[0], rows[1], BILINEAR_ONE - wy, wy,
+                c->dest->data + (size_t)y * row_len, row_len);
+    }
+}
+
 Image *resize_bilinear(const Image *src, int new_width, int new_height) {
     if (!src || new_width <= 0 || new_height <= 0) return NULL;
 
     Image *dest = createImage(new_width, new_height, src->channels);
     if (!dest) return NULL;
+    int ch = src->channels;
 
-    for (int y = 0; y < new_height; y++) {
-        for (int x = 0; x < new_width; x++) {
-            
-            // 1. Calculer la position correspondante dans l'image source (flottante)
-            // Le -0.5 permet de centrer les pixels pour un redimensionnement plus précis
-            float src_x = (x + 0.5f) * ((float)src->width / new_width) - 0.5f;
-            float src_y = (y + 0.5f) * ((float)src->height / new_height) - 0.5f;
-
-            // 2. Trouver les coordonnées du pixel en haut à gauche (x1, y1)
-            int x1 = (int)floor(src_x);
-            int y1 = (int)floor(src_y);
-            int x2 = x1 + 1;
-            int y2 = y1 + 1;
-
-            // 3. Calculer les poids (partie fractionnaire)
-            float dx = src_x - x1;
-            float dy = src_y - y1;
-            float one_minus_dx = 1.0f - dx;
-            float one_minus_dy = 1.0f - dy;
-
-            // 4. Gérer les bords (Clamp)
-            if (x1 < 0) x1 = 0; 
-            if (y1 < 0) y1 = 0;
-            if (x2 >= src->width) x2 = src->width - 1;
-            if (y2 >= src->height) y2 = src->height - 1;
-
-            // 5. Calculer pour chaque canal
-            for (int c = 0; c < src->channels; c++) {
-                // Récupérer les valeurs des 4 voisins
-                uint8_t p11 = src->data[(y1 * src->width + x1) * src->channels + c]; // Haut-Gauche
-                uint8_t p12 = src->data[(y1 * src->width + x2) * src->channels + c]; // Haut-Droite
-                uint8_t p21 = src->data[(y2 * src->width + x1) * src->channels + c]; // Bas-Gauche
-                uint8_t p22 = src->data[(y2 * src->width + x2) * src->channels + c]; // Bas-Droite
+    BilinearTables t;
+    t.x0 = malloc(new_width * sizeof(int));
+    t.x1 = malloc(new_width * sizeof(int));
+    t.wx = malloc(new_width * sizeof(uint16_t));
+    t.y0 = malloc(new_height * sizeof(int));
+    t.y1 = malloc(new_height * sizeof(int));
+    t.wy = malloc(new_height * sizeof(uint16_t));
+    int num_threads = parallel_thread_count(new_height, 16);
+    uint16_t **rings = calloc(num_threads, sizeof(uint16_t *));
+    int ok = t.x0 && t.x1 && t.wx && t.y0 && t.y1 && t.wy && rings;
+    for (int i = 0; ok && i < num_threads; i++) {
+        rings[i] = malloc(2 * (size_t)new_width * ch * sizeof(uint16_t));
+        if (!rings[i]) ok = 0;
+    }
 
-                // Formule Bilinéaire : somme pondérée
-                float val = 
-                    p11 * one_minus_dx * one_minus_dy +
-                    p12 * dx * one_minus_dy +
-                    p21 * one_minus_dx * dy +
-                    p22 * dx * dy;
+    if (ok) {
+        _bilinear_axis(src->width, new_width, ch, t.x0, t.x1, t.wx);
+        _bilinear_axis(src->height, new_height, 1, t.y0, t.y1, t.wy);
+        BilinearContext c = {src, dest, &t, _select_bilinear_vrow(), rings};
+        parallel_for(new_height, num_threads, _bilinear_rows, &c);
+    }
 
-                dest->data[(y * new_width + x) * src->channels + c] = (uint8_t)val;
-            }
-        }
+    for (int i = 0; rings && i < num_threads; i++) free(rings[i]);
+    free(rings);
+    free(t.x0);
+    free(t.x1);
+    free(t.wx);
+    free(t.y0);
+    free(t.y1);
+    free(t.wy);
+    if (!ok) {
+        freeImage(dest);
+        return NULL;
     }
+
     printf("Redimensionnement (Bilinéaire) : %dx%d -> %dx%d\n", src->width, src->height, new_width, new_height);
     return dest;
 }
 
-#include <math.h>
+// --- Réduction par moyenne de surface ---
+//
+// Chaque pixel de sortie est la moyenne des pixels sources qu'il recouvre
+// (pondérés par la fraction recouverte) : aucun pixel source n'est ignoré,
+// ce qui évite le crénelage des grandes réductions.
+
+typedef struct {
+    const Image *src;
+    Image *dest;
+    int fx, fy;          // Facteurs entiers (chemin rapide), 0 sinon
+    // Chemin général : contributions par axe (premier indice, nombre, poids)
+    const int *x_first, *x_count, *y_first, *y_count;
+    const float *x_weights, *y_weights; // Poids, cumulés par axe (indices x_first[d] à ...)
+    const int *x_offset, *y_offset;     // Début des poids de chaque sortie
+    float **buffers;     // Par thread : accumulateur + ligne horizontale
+} AreaContext;
+
+// Facteur 2 : moyenne de 2x2 arrondie
+static void _area_rows_2x(void *ctx, int begin, int end, int thread_id) {
+    (void)thread_id;
+    AreaContext *c = ctx;
+    int ch = c->src->channels;
+    int row_len = c->dest->width * ch;
+    size_t src_stride = (size_t)c->src->width * ch;
+    for (int y = begin; y < end; y++) {
+        const uint8_t *r0 = c->src->data + (size_t)(2 * y) * src_stride;
+        const uint8_t *r1 = r0 + src_stride;
+        uint8_t *out = c->dest->data + (size_t)y * row_len;
+        for (int x = 0; x < c->dest->width; x++) {
+            for (int k = 0; k < ch; k++) {
+                int i = 2 * x * ch + k;
+                out[x * ch + k] = (uint8_t)((r0[i] + r0[i + ch] + r1[i] + r1[i + ch] + 2) >> 2);
+            }
+        }
+    }
+}
+
+// Facteurs entiers fx x fy : sommes entières, division par décalage si fx * fy est une puissance de 2 (ex: 4x)
+static void _area_rows_integer(void *ctx, int begin, int end, int thread_id) {
+    AreaContext *c = ctx;
+    int ch = c->src->channels;
+    int dst_w = c->dest->width;
+    int row_len = dst_w * ch;
+    size_t src_stride = (size_t)c->src->width * ch;
+    uint32_t *sums = (uint32_t *)c->buffers[thread_id];
+    uint32_t n = (uint32_t)c->fx * c->fy;
+    int shift = (n & (n - 1)) == 0 ? __builtin_ctz(n) : -1;
+
+    for (int y = begin; y < end; y++) {
+        memset(sums, 0, row_len * sizeof(uint32_t));
+        for (int r = 0; r < c->fy; r++) {
+            const uint8_t *row = c->src->data + (size_t)(y * c->fy + r) * src_stride;
+            for (int x = 0; x < dst_w; x++) {
+                const uint8_t *p = row + (size_t)x * c->fx * ch;
+                for (int j = 0; j < c->fx; j++) {
+                    for (int k = 0; k < ch; k++) sums[x * ch + k] += p[j * ch + k];
+                }
+            }
+        }
+        uint8_t *out = c->dest->data + (size_t)y * row_len;
+        if (shift >= 0) {
+            for (int i = 0; i < row_len; i++) out[i] = (uint8_t)((sums[i] + n / 2) >> shift);
+        } else {
+            for (int i = 0; i < row_len; i++) out[i] = (uint8_t)((sums[i] + n / 2) / n);
+        }
+    }
+}
+
+// Facteurs quelconques : poids fractionnaires aux bords de chaque pixel de sortie
+static void _area_rows_general(void *ctx, int begin, int end, int thread_id) {
+    AreaContext *c = ctx;
+    int ch = c->src->channels;
+    int dst_w = c->dest->width;
+    int row_len = dst_w * ch;
+    size_t src_stride = (size_t)c->src->width * ch;
+    float *acc = c->buffers[thread_id];
+    float *hrow = acc + row_len;
+
+    for (int y = begin; y < end; y++) {
+        memset(acc, 0, row_len * sizeof(float));
+        for (int r = 0; r < c->y_count[y]; r++) {
+            const uint8_t *row = c->src->data + (size_t)(c->y_first[y] + r) * src_stride;
+            float wy = c->y_weights[c->y_offset[y] + r];
+            for (int x = 0; x < dst_w; x++) {
+                const uint8_t *p = row + (size_t)c->x_first[x] * ch;
+                const float *wx = c->x_weights + c->x_offset[x];
+                for (int k = 0; k < ch; k++) {
+                    float sum = 0.0f;
+                    for (int j = 0; j < c->x_count[x]; j++) sum += wx[j] * p[j * ch + k];
+                    hrow[x * ch + k] = sum;
+                }
+            }
+            for (int i = 0; i < row_len; i++) acc[i] += wy * hrow[i];
+        }
+        uint8_t *out = c->dest->data + (size_t)y * row_len;
+        for (int i = 0; i < row_len; i++) {
+            float v = acc[i] + 0.5f;
+            out[i] = v >= 255.0f ? 255 : (uint8_t)v;
+        }
+    }
+}
+
+// Contributions d'un axe : la sortie d couvre [d * scale, (d + 1) * scale[ en coordonnées sources.
+// Les poids sont normalisés (somme 1). Retourne le nombre total de poids, ou -1.
+static int _area_axis(int src_size, int dst_size, int *first, int *count, int *offset, float **weights) {
+    double scale = (double)src_size / dst_size;
+    int total = 0;
+    for (int d = 0; d < dst_size; d++) {
+        double start = d * scale, stop = (d + 1) * scale;
+        int i0 = (int)floor(start);
+        int i1 = (int)ceil(stop - 1e-9);
+        if (i1 > src_size) i1 = src_size;
+        first[d] = i0;
+        count[d] = i1 - i0;
+        offset[d] = total;
+        total += count[d];
+    }
+    *weights = malloc(total * sizeof(float));
+    if (!*weights) return -1;
+    for (int d = 0; d < dst_size; d++) {
+        double start = d * scale, stop = (d + 1) * scale;
+        for (int j = 0; j < count[d]; j++) {
+            int i = first[d] + j;
+            double lo = i > start ? i : start;
+            double hi = i + 1 < stop ? i + 1 : stop;
+            (*weights)[offset[d] + j] = (float)((hi - lo) / scale);
+        }
+    }
+    return total;
+}
+
+Image *resize_area(const Image *src, int new_width, int new_height) {
+    if (!src || !src->data || new_width <= 0 || new_height <= 0) return NULL;
+    if (new_width > src->width || new_height > src->height) {
+        // Pas de réduction sur un axe : la moyenne de surface n'apporte rien
+        return resize_bilinear(src, new_width, new_height);
+    }
+
+    Image *dest = createImage(new_width, new_height, src->channels);
+    if (!dest) return NULL;
+    int ch = src->channels;
+    int row_len = new_width * ch;
+
+    AreaContext c;
+    memset(&c, 0, sizeof(c));
+    c.src = src;
+    c.dest = dest;
+    if (src->width % new_width == 0 && src->height % new_height == 0) {
+        c.fx = src->width / new_width;
+        c.fy = src->height / new_height;
+    }
+
+    int num_threads = parallel_thread_count(new_height, 8);
+    ParallelRangeFn fn;
+    int ok = 1;
+    int *tables = NULL;
+    float *x_weights = NULL, *y_weights = NULL;
+    c.buffers = calloc(num_threads, sizeof(float *));
+    if (!c.buffers) ok = 0;
+
+    if (ok && c.fx == 2 && c.fy == 2) {
+        fn = _area_rows_2x;
+    } else if (ok && c.fx > 0) {
+        fn = _area_rows_integer;
+        for (int i = 0; ok && i < num_threads; i++) {
+            c.buffers[i] = malloc(row_len * sizeof(uint32_t));
+            if (!c.buffers[i]) ok = 0;
+        }
+    } else {
+        fn = _area_rows_general;
+        tables = malloc(3 * (size_t)(new_width + new_height) * sizeof(int));
+        if (!tables) ok = 0;
+        if (ok) {
+            int *x_first = tables, *x_count = x_first + new_width, *x_offset = x_count + new_width;
+            int *y_first = x_offset + new_width, *y_count = y_first + new_height, *y_offset = y_count + new_height;
+            if (_area_axis(src->width, new_width, x_first, x_count, x_offset, &x_weights) < 0 ||
+                _area_axis(src->height, new_height, y_first, y_count, y_offset, &y_weights) < 0) {
+                ok = 0;
+            }
+            c.x_first = x_first; c.x_count = x_count; c.x_offset = x_offset; c.x_weights = x_weights;
+            c.y_first = y_first; c.y_count = y_count; c.y_offset = y_offset; c.y_weights = y_weights;
+        }
+        for (int i = 0; ok && i < num_threads; i++) {
+            c.buffers[i] = malloc(2 * (size_t)row_len * sizeof(float));
+            if (!c.buffers[i]) ok = 0;
+        }
+    }
+
+    if (ok) parallel_for(new_height, num_threads, fn, &c);
+
+    for (int i = 0; c.buffers && i < num_threads; i++) free(c.buffers[i]);
+    free(c.buffers);
+    free(tables);
+    free(x_weights);
+    free(y_weights);
+    if (!ok) {
+        freeImage(dest);
+        return NULL;
+    }
+
+    printf("Redimensionnement (Moyenne de surface) : %dx%d -> %dx%d\n", src->width, src->height, new_width, new_height);
+    return dest;
+}
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-Image *rotate_image(const Image *src, double angle_deg) {
-    if (!src) return NULL;
-    
-    Image *dest = createImage(src->width, src->height, src->channels);
-    if (!dest) return NULL;
+// --- Rotation ---
+//
+// Inverse mapping : chaque pixel de destination lit sa position source.
+// Le long d'une ligne, la position source avance d'un pas constant
+// (cos, -sin) : elle est calculée une fois par ligne, puis incrémentée en
+// virgule fixe 32.32 (DDA), sans multiplication ni arrondi flottant par pixel.
 
-    // Convertir en radians
-    double theta = angle_deg * M_PI / 180.0;
-    double cos_t = cos(theta);
-    double sin_t = sin(theta);
-
-    int cx = src->width / 2;
-    int cy = src->height / 2;
-
-    // Pour éviter les trous, on parcourt l'image de DESTINATION (Inverse Mapping)
-    for (int y = 0; y < dest->height; y++) {
-        for (int x = 0; x < dest->width; x++) {
-            
-            // Coordonnées par rapport au centre
-            int dx = x - cx;
-            int dy = y - cy;
-
-            // Rotation inverse
-            // src_x = x' cos(t) + y' sin(t)
-            // src_y = -x' sin(t) + y' cos(t)
-            int src_x = (int)(dx * cos_t + dy * sin_t) + cx;
-            int src_y = (int)(-dx * sin_t + dy * cos_t) + cy;
-
-            // Vérifier si on est dans l'image source
-            if (src_x >= 0 && src_x < src->width && src_y >= 0 && src_y < src->height) {
-                for (int c = 0; c < src->channels; c++) {
-                    dest->data[(y * dest->width + x) * src->channels + c] = 
-                        src->data[(src_y * src->width + src_x) * src->channels + c];
+#define ROTATE_FRAC_BITS 32
+#define ROTATE_BLOCK 32 // Côté des blocs de la transposition
+
+typedef struct {
+    const Image *src;
+    Image *dest;
+    RotateInterpolation interp;
+    double cos_t, sin_t;
+    double src_cx, src_cy; // Centres (réels) de la source et de la destination
+    double dst_cx, dst_cy;
+} RotateContext;
+
+static inline int64_t _to_fixed(double v) {
+    return (int64_t)llround(v * 4294967296.0);
+}
+
+// Lit un pixel source, noir en dehors de l'image
+static inline int _fetch(const Image *src, int x, int y, int c) {
+    if (x < 0 || x >= src->width || y < 0 || y >= src->height) return 0;
+    return src->data[((size_t)y * src->width + x) * src->channels + c];
+}
+
+static void _rotate_rows(void *ctx, int begin, int end, int thread_id) {
+    (void)thread_id;
+    RotateContext *c = ctx;
+    const Image *src = c->src;
+    int ch = src->channels;
+    int sw = src->width, sh = src->height;
+    int dw = c->dest->width;
+    int64_t du = _to_fixed(c->cos_t);
+    int64_t dv = _to_fixed(-c->sin_t);
+
+    for (int y = begin; y < end; y++) {
+        // Position source du premier pixel de la ligne
+        double ox = -c->dst_cx, oy = y - c->dst_cy;
+        int64_t u = _to_fixed(c->src_cx + ox * c->cos_t + oy * c->sin_t);
+        int64_t v = _to_fixed(c->src_cy - ox * c->sin_t + oy * c->cos_t);
+        uint8_t *out = c->dest->data + (size_t)y * dw * ch;
+
+        if (c->interp == ROTATE_NEAREST) {
+            const int64_t half = (int64_t)1 << (ROTATE_FRAC_BITS - 1);
+            for (int x = 0; x < dw; x++, u += du, v += dv) {
+                int sx = (int)((u + half) >> ROTATE_FRAC_BITS);
+                int sy = (int)((v + half) >> ROTATE_FRAC_BITS);
+                if (sx >= 0 && sx < sw && sy >= 0 && sy < sh) {
+                    const uint8_t *p = src->data + ((size_t)sy * sw + sx) * ch;
+                    for (int k = 0; k < ch; k++) out[x * ch + k] = p[k];
+                } else {
+                    for (int k = 0; k < ch; k++) out[x * ch + k] = 0;
+                }
+            }
+            continue;
+        }
+
+        // Bilinéaire : poids Q8 tirés des bits de poids fort de la partie fractionnaire
+        for (int x = 0; x < dw; x++, u += du, v += dv) {
+            int x0 = (int)(u >> ROTATE_FRAC_BITS);
+            int y0 = (int)(v >> ROTATE_FRAC_BITS);
+            int fx = (int)((u >> (ROTATE_FRAC_BITS - 8)) & 0xFF);
+            int fy = (int)((v >> (ROTATE_FRAC_BITS - 8)) & 0xFF);
+            if (x0 < -1 || x0 >= sw || y0 < -1 || y0 >= sh) {
+                for (int k = 0; k < ch; k++) out[x * ch + k] = 0;
+                continue;
+            }
+            int w00 = (256 - fx) * (256 - fy), w10 = fx * (256 - fy);
+            int w01 = (256 - fx) * fy, w11 = fx * fy;
+            if (x0 >= 0 && x0 + 1 < sw && y0 >= 0 && y0 + 1 < sh) {
+                const uint8_t *p = src->data + ((size_t)y0 * sw + x0) * ch;
+                const uint8_t *q = p + (size_t)sw * ch;
+                for (int k = 0; k < ch; k++) {
+                    int sum = p[k] * w00 + p[ch + k] * w10 + q[k] * w01 + q[ch + k] * w11;
+                    out[x * ch + k] = (uint8_t)((sum + (1 << 15)) >> 16);
                 }
             } else {
-                // Fond noir
-                for (int c = 0; c < src->channels; c++) {
-                    dest->data[(y * dest->width + x) * src->channels + c] = 0;
+                // Bord : les voisins hors de l'image comptent pour du noir
+                for (int k = 0; k < ch; k++) {
+                    int sum = _fetch(src, x0, y0, k) * w00 + _fetch(src, x0 + 1, y0, k) * w10 +
+                              _fetch(src, x0, y0 + 1, k) * w01 + _fetch(src, x0 + 1, y0 + 1, k) * w11;
+                    out[x * ch + k] = (uint8_t)((sum + (1 << 15)) >> 16);
                 }
             }
         }
     }
+}
+
+// Rotations exactes d'un quart de tour (sens horaire) par transposition en blocs :
+// les lectures et écritures restent dans des blocs de ROTATE_BLOCK x ROTATE_BLOCK pixels.
+static Image *_rotate_quarter(const Image *src, int quarters) {
+    int w = src->width, h = src->height, ch = src->channels;
+    int dw = quarters == 2 ? w : h;
+    int dh = quarters == 2 ? h : w;
+    Image *dest = createImage(dw, dh, ch);
+    if (!dest) return NULL;
+
+    if (quarters == 2) {
+        for (int y = 0; y < h; y++) {
+            const uint8_t *row = src->data + (size_t)y * w * ch;
+            uint8_t *out = dest->data + (size_t)(h - 1 - y) * w * ch;
+            for (int x = 0; x < w; x++) {
+                for (int k = 0; k < ch; k++) out[(w - 1 - x) * ch + k] = row[x * ch + k];
+            }
+        }
+        return dest;
+    }
+
+    for (int by = 0; by < dh; by += ROTATE_BLOCK) {
+        int ey = by + ROTATE_BLOCK < dh ? by + ROTATE_BLOCK : dh;
+        for (int bx = 0; bx < dw; bx += ROTATE_BLOCK) {
+            int ex = bx + ROTATE_BLOCK < dw ? bx + ROTATE_BLOCK : dw;
+            for (int y = by; y < ey; y++) {
+                uint8_t *out = dest->data + (size_t)y * dw * ch;
+                for (int x = bx; x < ex; x++) {
+                    // 90° : dest(x, y) = src(y, h-1-x) ; 270° : dest(x, y) = src(w-1-y, x)
+                    int sx = quarters == 1 ? y : w - 1 - y;
+                    int sy = quarters == 1 ? h - 1 - x : x;
+                    const uint8_t *p = src->data + ((size_t)sy * w + sx) * ch;
+                    for (int k = 0; k < ch; k++) out[x * ch + k] = p[k];
+                }
+            }
+        }
+    }
+    return dest;
+}
+
+Image *rotate_image_ex(const Image *src, double angle_deg, RotateInterpolation interp, int expand) {
+    if (!src || !src->data) return NULL;
+
+    // Quart de tour exact : transposition (si les dimensions le permettent)
+    double turns = angle_deg / 90.0;
+    double nearest_turn = floor(turns + 0.5);
+    if (fabs(turns - nearest_turn) < 1e-9) {
+        int quarters = (int)(((long long)nearest_turn % 4 + 4) % 4);
+        if (quarters == 0 || quarters == 2 || expand || src->width == src->height) {
+            Image *dest;
+            if (quarters == 0) {
+                dest = createImage(src->width, src->height, src->channels);
+                if (dest) memcpy(dest->data, src->data, (size_t)src->width * src->height * src->channels);
+            } else {
+                dest = _rotate_quarter(src, quarters);
+            }
+            if (dest) printf("Rotation de %.2f degrés appliquée (quart de tour exact).\n", angle_deg);
+            return dest;
+        }
+    }
+
+    double theta = angle_deg * M_PI / 180.0;
+    RotateContext c;
+    c.src = src;
+    c.interp = interp;
+    c.cos_t = cos(theta);
+    c.sin_t = sin(theta);
+    int dw = src->width, dh = src->height;
+    if (expand) {
+        // Boîte englobante de l'image tournée
+        double fw = fabs(src->width * c.cos_t) + fabs(src->height * c.sin_t);
+        double fh = fabs(src->width * c.sin_t) + fabs(src->height * c.cos_t);
+        dw = (int)ceil(fw - 1e-6);
+        dh = (int)ceil(fh - 1e-6);
+    }
+    c.dest = createImage(dw, dh, src->channels);
+    if (!c.dest) return NULL;
+    c.src_cx = (src->width - 1) / 2.0;
+    c.src_cy = (src->height - 1) / 2.0;
+    c.dst_cx = (dw - 1) / 2.0;
+    c.dst_cy = (dh - 1) / 2.0;
+
+    parallel_for(dh, parallel_thread_count(dh, 16), _rotate_rows, &c);
+
     printf("Rotation de %.2f degrés appliquée.\n", angle_deg);
+    return c.dest;
+}
+
+Image *rotate_image(const Image *src, double angle_deg) {
+    return rotate_image_ex(src, angle_deg, ROTATE_NEAREST, 0);
+}
+
+// --- Rotation par trois cisaillements (Paeth) ---
+//
+// R(t) = Sx(a) . Sy(b) . Sx(a), avec a = -tan(t/2) et b = sin(t) : chaque
+// cisaillement décale une ligne (ou une colonne) entière d'une même quantité,
+// donc une seule paire de poids d'interpolation par ligne (ou par colonne)
+// et des accès mémoire séquentiels.
+
+#define SHEAR_STRIP 1024 // Largeur (en pixels) des bandes de colonnes du cisaillement vertical
+
+typedef struct {
+    const Image *src;
+    Image *dest;
+    double shear;          // Décalage par ligne (Sx) ou par colonne (Sy)
+    double src_cx, src_cy; // Centres réels des deux images
+    double dst_cx, dst_cy;
+    int *offsets;          // Sy : décalage entier de chaque colonne
+    ptrdiff_t *columns;    // Sy : position du premier voisin (offsets[x] lignes plus bas, colonne x)
+    uint8_t *weights;      // Sy : poids Q8 de chaque colonne
+} ShearContext;
+
+// Décalage réel -> (entier, poids Q8 du voisin suivant)
+static inline void _split_shift(double d, int *i0, int *f) {
+    double fl = floor(d);
+    *i0 = (int)fl;
+    *f = (int)lround((d - fl) * 256.0);
+    if (*f == 256) {
+        (*i0)++;
+        *f = 0;
+    }
+}
+
+// Cisaillement horizontal : la ligne y de la destination est la ligne
+// correspondante de la source, décalée de shear * (y - centre)
+static void _shear_x_rows(void *ctx, int begin, int end, int thread_id) {
+    (void)thread_id;
+    ShearContext *c = ctx;
+    const Image *src = c->src;
+    int ch = src->channels, sw = src->width, dw = c->dest->width;
+    int row_offset = (int)lround(c->src_cy - c->dst_cy); // Entier : hauteurs de même parité
+
+    for (int y = begin; y < end; y++) {
+        uint8_t *out = c->dest->data + (size_t)y * dw * ch;
+        int sy = y + row_offset;
+        if (sy < 0 || sy >= src->height) {
+            memset(out, 0, (size_t)dw * ch);
+            continue;
+        }
+        const uint8_t *in = src->data + (size_t)sy * sw * ch;
+        int i0, f;
+        _split_shift(c->src_cx - c->dst_cx - c->shear * (y - c->dst_cy), &i0, &f);
+
+        // Pixels de sortie dont les deux voisins x + i0 et x + i0 + 1 sont dans la source
+        int x_first = -i0 > 0 ? -i0 : 0;
+        int x_last = sw - 1 - i0 < dw ? sw - 1 - i0 : dw; // Exclu
+        if (x_last < x_first) x_last = x_first;
+        int g = 256 - f;
+
+        for (int x = 0; x < x_first && x < dw; x++) {
+            // Bord gauche : seul le voisin de droite peut être dans la source
+            int j = x + i0 + 1;
+            for (int k = 0; k < ch; k++) {
+                out[x * ch + k] = (j >= 0 && j < sw) ? (uint8_t)((in[j * ch + k] * f + 128) >> 8) : 0;
+            }
+        }
+        const uint8_t *p = in + i0 * ch;
+        for (int b = x_first * ch; b < x_last * ch; b++) {
+            out[b] = (uint8_t)((p[b] * g + p[b + ch] * f + 128) >> 8);
+        }
+        for (int x = x_last > x_first ? x_last : x_first; x < dw; x++) {
+            // Bord droit : seul le voisin de gauche peut être dans la source
+            int j = x + i0;
+            for (int k = 0; k < ch; k++) {
+                out[x * ch + k] = (j >= 0 && j < sw) ? (uint8_t)((in[j * ch + k] * g + 128) >> 8) : 0;
+            }
+        }
+    }
+}
+
+// Interpolation verticale d'un morceau de ligne sans test de bord. columns[x]
+// donne la position, par rapport à la ligne y, du premier voisin de la colonne x.
+// Appelée avec ch constant pour que la boucle sur les canaux soit déroulée.
+static inline __attribute__((always_inline)) void _shear_y_span(const uint8_t *row, uint8_t *out,
+                                                               const ptrdiff_t *columns, const uint8_t *weights,
+                                                               size_t stride, int x_begin, int x_end, int ch) {
+    for (int x = x_begin; x < x_end; x++) {
+        const uint8_t *p0 = row + columns[x];
+        int f = weights[x], g = 256 - f;
+        for (int k = 0; k < ch; k++) {
+            out[x * ch + k] = (uint8_t)((p0[k] * g + p0[stride + k] * f + 128) >> 8);
+        }
+    }
+}
+
+// Cisaillement vertical, par bandes de SHEAR_STRIP colonnes : pour une bande,
+// les lignes sources lues autour de la ligne courante restent en cache.
+static void _shear_y_strips(void *ctx, int begin, int end, int thread_id) {
+    (void)thread_id;
+    ShearContext *c = ctx;
+    const Image *src = c->src;
+    int ch = src->channels, w = src->width, sh = src->height;
+    int dh = c->dest->height;
+    size_t stride = (size_t)w * ch;
+
+    for (int strip = begin; strip < end; strip++) {
+        int x_begin = strip * SHEAR_STRIP;
+        int x_end = x_begin + SHEAR_STRIP < w ? x_begin + SHEAR_STRIP : w;
+
+        // Lignes de sortie pour lesquelles les deux voisins de toutes les colonnes
+        // de la bande sont dans la source : boucle sans test
+        int min_off = c->offsets[x_begin], max_off = c->offsets[x_begin];
+        for (int x = x_begin; x < x_end; x++) {
+            if (c->offsets[x] < min_off) min_off = c->offsets[x];
+            if (c->offsets[x] > max_off) max_off = c->offsets[x];
+        }
+        int y_first = -min_off, y_last = sh - 1 - max_off; // [y_first, y_last)
+
+        for (int y = 0; y < dh; y++) {
+            uint8_t *out = c->dest->data + (size_t)y * stride;
+            if (y >= y_first && y < y_last) {
+                const uint8_t *row = src->data + (size_t)y * stride;
+                if (ch == 1) _shear_y_span(row, out, c->columns, c->weights, stride, x_begin, x_end, 1);
+                else if (ch == 3) _shear_y_span(row, out, c->columns, c->weights, stride, x_begin, x_end, 3);
+                else _shear_y_span(row, out, c->columns, c->weights, stride, x_begin, x_end, ch);
+                continue;
+            }
+            for (int x = x_begin; x < x_end; x++) {
+                int sy = y + c->offsets[x];
+                int f = c->weights[x], g = 256 - f;
+                for (int k = 0; k < ch; k++) {
+                    int sum = 0;
+                    if (sy >= 0 && sy < sh) sum += src->data[(size_t)sy * stride + x * ch + k] * g;
+                    if (sy + 1 >= 0 && sy + 1 < sh) sum += src->data[(size_t)(sy + 1) * stride + x * ch + k] * f;
+                    out[x * ch + k] = (uint8_t)((sum + 128) >> 8);
+                }
+            }
+        }
+    }
+}
+
+static Image *_shear_x(const Image *src, double shear, int dw, int dh) {
+    ShearContext c = {src, createImage(dw, dh, src->channels), shear,
+                      (src->width - 1) / 2.0, (src->height - 1) / 2.0,
+                      (dw - 1) / 2.0, (dh - 1) / 2.0, NULL, NULL, NULL};
+    if (!c.dest) return NULL;
+    parallel_for(dh, parallel_thread_count(dh, 16), _shear_x_rows, &c);
+    return c.dest;
+}
+
+static Image *_shear_y(const Image *src, double shear, int dh) {
+    int w = src->width;
+    ShearContext c = {src, createImage(w, dh, src->channels), shear,
+                      (w - 1) / 2.0, (src->height - 1) / 2.0,
+                      (w - 1) / 2.0, (dh - 1) / 2.0, NULL, NULL, NULL};
+    if (!c.dest) return NULL;
+    c.offsets = malloc(w * sizeof(int));
+    c.columns = malloc(w * sizeof(ptrdiff_t));
+    c.weights = malloc(w);
+    if (!c.offsets || !c.columns || !c.weights) {
+        free(c.offsets);
+        free(c.columns);
+        free(c.weights);
+        freeImage(c.dest);
+        return NULL;
+    }
+    for (int x = 0; x < w; x++) {
+        int i0, f;
+        _split_shift(c.src_cy - c.dst_cy - shear * (x - c.src_cx), &i0, &f);
+        c.offsets[x] = i0;
+        c.columns[x] = (ptrdiff_t)i0 * w * src->channels + (ptrdiff_t)x * src->channels;
+        c.weights[x] = (uint8_t)f;
+    }
+    int strips = (w + SHEAR_STRIP - 1) / SHEAR_STRIP;
+    parallel_for(strips, parallel_thread_count(strips, 1), _shear_y_strips, &c);
+    free(c.offsets);
+    free(c.columns);
+    free(c.weights);
+    return c.dest;
+}
+
+Image *rotate_image_shear(const Image *src, double angle_deg, int expand) {
+    if (!src || !src->data) return NULL;
+
+    // Les quarts de tour exacts ne demandent aucune interpolation
+    double turns = angle_deg / 90.0;
+    double nearest_turn = floor(turns + 0.5);
+    if (fabs(turns - nearest_turn) < 1e-9) return rotate_image_ex(src, angle_deg, ROTATE_NEAREST, expand);
+
+    // Cadre final, identique à celui de rotate_image_ex
+    double theta = angle_deg * M_PI / 180.0;
+    int dw = src->width, dh = src->height;
+    if (expand) {
+        double fw = fabs(src->width * cos(theta)) + fabs(src->height * sin(theta));
+        double fh = fabs(src->width * sin(theta)) + fabs(src->height * cos(theta));
+        dw = (int)ceil(fw - 1e-6);
+        dh = (int)ceil(fh - 1e-6);
+    }
+
+    // Les cisaillements ne sont utilisés que pour |angle| <= 45° : le reste
+    // est d'abord tourné d'un nombre exact de quarts de tour
+    int quarters = (int)(((long long)nearest_turn % 4 + 4) % 4);
+    double rest = (angle_deg - 90.0 * nearest_turn) * M_PI / 180.0;
+    const Image *base = src;
+    Image *turned = NULL;
+    if (quarters != 0) {
+        turned = _rotate_quarter(src, quarters);
+        if (!turned) return NULL;
+        base = turned;
+    }
+
+    double a = -tan(rest / 2.0), b = sin(rest);
+    int w = base->width, h = base->height;
+    // Tailles intermédiaires : contenu cisaillé plus un pixel de bord fondu de chaque
+    // côté, limité à ce que lit la passe suivante (les lignes du dernier cisaillement
+    // sont celles du cadre final).
+    // Parités : w1 a celle de w, pour que le premier cisaillement ne décale pas
+    // toutes les lignes d'un demi-pixel ; h2 a celle de dh, pour que le dernier
+    // garde des lignes entières. Un décalage d'un demi-pixel ne reste que si le
+    // cadre final change de parité (dw != w ou dh != h modulo 2), et dans une
+    // seule passe.
+    int w1 = w + (int)ceil(fabs(a) * (h - 1)) + 2;
+    int w1_read = dw + (int)ceil(fabs(a) * (dh - 1)) + 3;
+    if (w1 > w1_read) w1 = w1_read;
+    if ((w1 - w) % 2 != 0) w1++;
+    int h2 = h + (int)ceil(fabs(b) * (w1 - 1)) + 2;
+    if ((h2 - dh) % 2 != 0) h2++;
+    if (h2 > dh) h2 = dh;
+
+    Image *pass1 = _shear_x(base, a, w1, h);
+    freeImage(turned);
+    if (!pass1) return NULL;
+    Image *pass2 = _shear_y(pass1, b, h2);
+    freeImage(pass1);
+    if (!pass2) return NULL;
+    Image *dest = _shear_x(pass2, a, dw, dh);
+    freeImage(pass2);
+    if (!dest) return NULL;
+
+    printf("Rotation de %.2f degrés appliquée (trois cisaillements).\n", angle_deg);
     return dest;
-}
\ No newline at end of file
+}
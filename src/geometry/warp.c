@@ -0,0 +1,356 @@
+#include "geometry/warp.h"
+#include "core/parallel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#define WARP_TILE 64      // Côté des tuiles de sortie
+#define WARP_OUTSIDE (-2) // Coordonnée source marquant un pixel entièrement hors de la source
+
+// Déformation inverse (destination -> source), m[6..8] = {0, 0, 1} en affine
+typedef struct {
+    int perspective;
+    double m[9];
+    int src_width, src_height;
+} WarpTransform;
+
+// Positions sources d'une suite de pixels : coin haut-gauche du voisinage
+// 2x2 et parties fractionnaires sur 8 bits
+typedef struct {
+    int32_t *sx, *sy;
+    uint8_t *fx, *fy;
+} WarpCoords;
+
+struct WarpMap {
+    int src_width, src_height;
+    int out_width, out_height;
+    WarpCoords coords; // out_width * out_height positions, ligne par ligne
+};
+
+// Trois usages du même parcours par tuiles :
+//  - transform et dest : déformation à la volée ;
+//  - map et dest : application d'une table ;
+//  - transform et table : remplissage d'une table (dest == NULL).
+typedef struct {
+    const WarpTransform *transform;
+    WarpMap *map;
+    const Image *src;
+    Image *dest;
+    WarpInterpolation interp;
+    int out_width, out_height;
+} WarpContext;
+
+// --- Inversion des matrices ---
+
+static int _invert_affine(const double m[6], WarpTransform *t) {
+    double det = m[0] * m[4] - m[1] * m[3];
+    if (fabs(det) < 1e-12) return -1;
+    double a = m[4] / det, b = -m[1] / det, d = -m[3] / det, e = m[0] / det;
+    t->perspective = 0;
+    t->m[0] = a; t->m[1] = b; t->m[2] = -(a * m[2] + b * m[5]);
+    t->m[3] = d; t->m[4] = e; t->m[5] = -(d * m[2] + e * m[5]);
+    t->m[6] = 0.0; t->m[7] = 0.0; t->m[8] = 1.0;
+    return 0;
+}
+
+static int _invert_homography(const double m[9], WarpTransform *t) {
+    // Inverse par la comatrice
+    double c0 = m[4] * m[8] - m[5] * m[7];
+    double c1 = m[5] * m[6] - m[3] * m[8];
+    double c2 = m[3] * m[7] - m[4] * m[6];
+    double det = m[0] * c0 + m[1] * c1 + m[2] * c2;
+    if (fabs(det) < 1e-12) return -1;
+    t->perspective = 1;
+    t->m[0] = c0 / det;
+    t->m[1] = (m[2] * m[7] - m[1] * m[8]) / det;
+    t->m[2] = (m[1] * m[5] - m[2] * m[4]) / det;
+    t->m[3] = c1 / det;
+    t->m[4] = (m[0] * m[8] - m[2] * m[6]) / det;
+    t->m[5] = (m[2] * m[3] - m[0] * m[5]) / det;
+    t->m[6] = c2 / det;
+    t->m[7] = (m[1] * m[6] - m[0] * m[7]) / det;
+    t->m[8] = (m[0] * m[4] - m[1] * m[3]) / det;
+    return 0;
+}
+
+static int _prepare(const double *matrix, int perspective, int src_width, int src_height,
+                    int out_width, int out_height, WarpTransform *t) {
+    if (!matrix || src_width <= 0 || src_height <= 0 || out_width <= 0 || out_height <= 0) return -1;
+    int status = perspective ? _invert_homography(matrix, t) : _invert_affine(matrix, t);
+    if (status != 0) {
+        fprintf(stderr, "Erreur: matrice de déformation non inversible.\n");
+        return -1;
+    }
+    t->src_width = src_width;
+    t->src_height = src_height;
+    return 0;
+}
+
+// --- Calcul des positions sources ---
+
+// Position en virgule fixe 32.32 -> (entier, fraction), ou WARP_OUTSIDE
+static inline void _store_fixed(int64_t u, int size, int32_t *i, uint8_t *f) {
+    int64_t i0 = u >> 32;
+    if (i0 < -1 || i0 >= size) {
+        *i = WARP_OUTSIDE;
+        *f = 0;
+    } else {
+        *i = (int32_t)i0;
+        *f = (uint8_t)((u >> 24) & 0xFF);
+    }
+}
+
+static inline void _store_real(double u, int size, int32_t *i, uint8_t *f) {
+    if (!(u >= -1.0 && u < size)) { // Rejette aussi NaN
+        *i = WARP_OUTSIDE;
+        *f = 0;
+    } else {
+        double i0 = floor(u);
+        *i = (int32_t)i0;
+        *f = (uint8_t)((u - i0) * 256.0);
+    }
+}
+
+static inline int64_t _to_fixed(double v) {
+    return (int64_t)llround(v * 4294967296.0);
+}
+
+// Positions sources des pixels (x..x+n-1, y). Seul le premier point est
+// calculé directement, les suivants par incréments.
+static void _compute_run(const WarpTransform *t, int x, int y, int n, WarpCoords c) {
+    const double *m = t->m;
+    int sw = t->src_width, sh = t->src_height;
+
+    if (!t->perspective) {
+        double u0 = m[0] * x + m[1] * y + m[2];
+        double v0 = m[3] * x + m[4] * y + m[5];
+        // Hors de toute plage utile : inutile de passer en virgule fixe
+        if (fabs(u0) > 1e9 || fabs(v0) > 1e9) {
+            for (int i = 0; i < n; i++) {
+                _store_real(u0 + m[0] * i, sw, &c.sx[i], &c.fx[i]);
+                _store_real(v0 + m[3] * i, sh, &c.sy[i], &c.fy[i]);
+            }
+            return;
+        }
+        int64_t u = _to_fixed(u0), v = _to_fixed(v0);
+        int64_t du = _to_fixed(m[0]), dv = _to_fixed(m[3]);
+        for (int i = 0; i < n; i++, u += du, v += dv) {
+            _store_fixed(u, sw, &c.sx[i], &c.fx[i]);
+            _store_fixed(v, sh, &c.sy[i], &c.fy[i]);
+        }
+        return;
+    }
+
+    // Coordonnées homogènes : numérateurs et dénominateur avancent par additions
+    double X = m[0] * x + m[1] * y + m[2];
+    double Y = m[3] * x + m[4] * y + m[5];
+    double W = m[6] * x + m[7] * y + m[8];
+    if (m[6] == 0.0) {
+        // Dénominateur constant sur la ligne : une seule réciproque
+        if (W <= 1e-12) {
+            for (int i = 0; i < n; i++) {
+                c.sx[i] = c.sy[i] = WARP_OUTSIDE;
+                c.fx[i] = c.fy[i] = 0;
+            }
+            return;
+        }
+        double r = 1.0 / W;
+        for (int i = 0; i < n; i++, X += m[0], Y += m[3]) {
+            _store_real(X * r, sw, &c.sx[i], &c.fx[i]);
+            _store_real(Y * r, sh, &c.sy[i], &c.fy[i]);
+        }
+        return;
+    }
+    for (int i = 0; i < n; i++, X += m[0], Y += m[3], W += m[6]) {
+        if (W <= 1e-12) { // Derrière la caméra
+            c.sx[i] = c.sy[i] = WARP_OUTSIDE;
+            c.fx[i] = c.fy[i] = 0;
+            continue;
+        }
+        double r = 1.0 / W;
+        _store_real(X * r, sw, &c.sx[i], &c.fx[i]);
+        _store_real(Y * r, sh, &c.sy[i], &c.fy[i]);
+    }
+}
+
+// --- Échantillonnage ---
+
+// Lit un pixel source, noir en dehors de l'image
+static inline int _fetch(const Image *src, int x, int y, int c) {
+    if (x < 0 || x >= src->width || y < 0 || y >= src->height) return 0;
+    return src->data[((size_t)y * src->width + x) * src->channels + c];
+}
+
+static void _sample_run(const Image *src, WarpInterpolation interp, int n, WarpCoords c, uint8_t *out) {
+    int ch = src->channels, sw = src->width, sh = src->height;
+
+    if (interp == WARP_NEAREST) {
+        for (int i = 0; i < n; i++) {
+            int x = c.sx[i] + (c.fx[i] >> 7);
+            int y = c.sy[i] + (c.fy[i] >> 7);
+            if (c.sx[i] != WARP_OUTSIDE && c.sy[i] != WARP_OUTSIDE &&
+                x >= 0 && x < sw && y >= 0 && y < sh) {
+                const uint8_t *p = src->data + ((size_t)y * sw + x) * ch;
+                for (int k = 0; k < ch; k++) out[i * ch + k] = p[k];
+            } else {
+                for (int k = 0; k < ch; k++) out[i * ch + k] = 0;
+            }
+        }
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        int x0 = c.sx[i], y0 = c.sy[i];
+        if (x0 == WARP_OUTSIDE || y0 == WARP_OUTSIDE) {
+            for (int k = 0; k < ch; k++) out[i * ch + k] = 0;
+            continue;
+        }
+        int fx = c.fx[i], fy = c.fy[i];
+        int w00 = (256 - fx) * (256 - fy), w10 = fx * (256 - fy);
+        int w01 = (256 - fx) * fy, w11 = fx * fy;
+        if (x0 >= 0 && x0 + 1 < sw && y0 >= 0 && y0 + 1 < sh) {
+            const uint8_t *p = src->data + ((size_t)y0 * sw + x0) * ch;
+            const uint8_t *q = p + (size_t)sw * ch;
+            for (int k = 0; k < ch; k++) {
+                int sum = p[k] * w00 + p[ch + k] * w10 + q[k] * w01 + q[ch + k] * w11;
+                out[i * ch + k] = (uint8_t)((sum + (1 << 15)) >> 16);
+            }
+        } else {
+            // Bord : les voisins hors de l'image comptent pour du noir
+            for (int k = 0; k < ch; k++) {
+                int sum = _fetch(src, x0, y0, k) * w00 + _fetch(src, x0 + 1, y0, k) * w10 +
+                          _fetch(src, x0, y0 + 1, k) * w01 + _fetch(src, x0 + 1, y0 + 1, k) * w11;
+                out[i * ch + k] = (uint8_t)((sum + (1 << 15)) >> 16);
+            }
+        }
+    }
+}
+
+// --- Parcours par tuiles ---
+
+static inline WarpCoords _offset(WarpCoords c, size_t i) {
+    WarpCoords r = {c.sx + i, c.sy + i, c.fx + i, c.fy + i};
+    return r;
+}
+
+// Traite les bandes de tuiles [begin, end), chacune de WARP_TILE lignes,
+// tuile par tuile de gauche à droite.
+static void _warp_bands(void *ctx, int begin, int end, int thread_id) {
+    (void)thread_id;
+    WarpContext *w = ctx;
+    int ow = w->out_width, oh = w->out_height;
+    int32_t sx[WARP_TILE], sy[WARP_TILE];
+    uint8_t fx[WARP_TILE], fy[WARP_TILE];
+    WarpCoords local = {sx, sy, fx, fy};
+
+    for (int band = begin; band < end; band++) {
+        int y_begin = band * WARP_TILE;
+        int y_end = y_begin + WARP_TILE < oh ? y_begin + WARP_TILE : oh;
+        for (int tx = 0; tx < ow; tx += WARP_TILE) {
+            int n = tx + WARP_TILE < ow ? WARP_TILE : ow - tx;
+            for (int y = y_begin; y < y_end; y++) {
+                size_t index = (size_t)y * ow + tx;
+                if (!w->dest) {
+                    _compute_run(w->transform, tx, y, n, _offset(w->map->coords, index));
+                    continue;
+                }
+                WarpCoords c = local;
+                if (w->transform) _compute_run(w->transform, tx, y, n, local);
+                else c = _offset(w->map->coords, index);
+                _sample_run(w->src, w->interp, n, c, w->dest->data + index * w->dest->channels);
+            }
+        }
+    }
+}
+
+static void _run_tiles(WarpContext *w) {
+    int bands = (w->out_height + WARP_TILE - 1) / WARP_TILE;
+    parallel_for(bands, parallel_thread_count(bands, 1), _warp_bands, w);
+}
+
+static Image *_warp(const Image *src, const double *matrix, int perspective,
+                    int out_width, int out_height, WarpInterpolation interp) {
+    if (!src || !src->data) return NULL;
+    WarpTransform t;
+    if (_prepare(matrix, perspective, src->width, src->height, out_width, out_height, &t) != 0) return NULL;
+
+    Image *dest = createImage(out_width, out_height, src->channels);
+    if (!dest) return NULL;
+    WarpContext w = {&t, NULL, src, dest, interp, out_width, out_height};
+    _run_tiles(&w);
+    return dest;
+}
+
+Image *warp_affine(const Image *src, const double matrix[6], int out_width, int out_height,
+                   WarpInterpolation interp) {
+    return _warp(src, matrix, 0, out_width, out_height, interp);
+}
+
+Image *warp_perspective(const Image *src, const double matrix[9], int out_width, int out_height,
+                        WarpInterpolation interp) {
+    return _warp(src, matrix, 1, out_width, out_height, interp);
+}
+
+// --- Tables précalculées ---
+
+void warp_map_free(WarpMap *map) {
+    if (!map) return;
+    free(map->coords.sx);
+    free(map->coords.sy);
+    free(map->coords.fx);
+    free(map->coords.fy);
+    free(map);
+}
+
+static WarpMap *_create_map(const double *matrix, int perspective, int src_width, int src_height,
+                            int out_width, int out_height) {
+    WarpTransform t;
+    if (_prepare(matrix, perspective, src_width, src_height, out_width, out_height, &t) != 0) return NULL;
+
+    WarpMap *map = calloc(1, sizeof(WarpMap));
+    if (!map) return NULL;
+    size_t count = (size_t)out_width * out_height;
+    map->coords.sx = malloc(count * sizeof(int32_t));
+    map->coords.sy = malloc(count * sizeof(int32_t));
+    map->coords.fx = malloc(count);
+    map->coords.fy = malloc(count);
+    if (!map->coords.sx || !map->coords.sy || !map->coords.fx || !map->coords.fy) {
+        fprintf(stderr, "Erreur: allocation de la table de déformation impossible.\n");
+        warp_map_free(map);
+        return NULL;
+    }
+    map->src_width = src_width;
+    map->src_height = src_height;
+    map->out_width = out_width;
+    map->out_height = out_height;
+
+    // Même découpage en tuiles qu'à la volée : les positions sont identiques
+    WarpContext w = {&t, map, NULL, NULL, WARP_NEAREST, out_width, out_height};
+    _run_tiles(&w);
+    return map;
+}
+
+WarpMap *warp_map_create_affine(const double matrix[6], int src_width, int src_height,
+                                int out_width, int out_height) {
+    return _create_map(matrix, 0, src_width, src_height, out_width, out_height);
+}
+
+WarpMap *warp_map_create_perspective(const double matrix[9], int src_width, int src_height,
+                                     int out_width, int out_height) {
+    return _create_map(matrix, 1, src_width, src_height, out_width, out_height);
+}
+
+Image *warp_map_apply(const Image *src, const WarpMap *map, WarpInterpolation interp) {
+    if (!src || !src->data || !map) return NULL;
+    if (src->width != map->src_width || src->height != map->src_height) {
+        fprintf(stderr, "Erreur: l'image (%dx%d) ne correspond pas à la table de déformation (%dx%d).\n",
+                src->width, src->height, map->src_width, map->src_height);
+        return NULL;
+    }
+    Image *dest = createImage(map->out_width, map->out_height, src->channels);
+    if (!dest) return NULL;
+    WarpContext w = {NULL, (WarpMap *)map, src, dest, interp, map->out_width, map->out_height};
+    _run_tiles(&w);
+    return dest;
+}
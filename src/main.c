@@ -7,19 +7,33 @@
 #include "analysis/stats.h"
 #include "filters/pointwise.h"
 #include "filters/predefined_filters.h"
+#include "filters/convolution.h"
 #include "filters/histogram_equalization.h"
+#include "filters/adaptive_threshold.h"
 #include "cli/parser.h"
 #include "fft/fft.h"
+#include "fft/freq_filter.h"
+#include "fft/fft_tiled.h"
 #include "filters/arithmetic.h"
 #include "geometry/transform.h"
+#include "geometry/pyramid.h"
+#include "geometry/resample.h"
+#include "geometry/warp.h"
 #include "analysis/hough.h"
+#include "analysis/hough_circle.h"
 #include "analysis/segmentation.h"
+#include "analysis/labeling.h"
+#include "analysis/watershed.h"
+#include "core/parallel.h"
 
 int main(int argc, char *argv[]) {
     // ============================================================
     // ÉTAPE 1: PARSING DES ARGUMENTS
     // ============================================================
     Arguments args = parse_args(argc, argv);
+    if (args.num_threads > 0) {
+        parallel_set_num_threads(args.num_threads);
+    }
 
     // ============================================================
     // ÉTAPE 2: CHARGEMENT DE L'IMAGE
@@ -122,7 +136,15 @@ int main(int argc, char *argv[]) {
     // Redimensionnement
     if (args.resize_width > 0 && args.resize_height > 0) {
         Image *resized = NULL;
-        if (args.resize_bilinear) {
+        if (args.resize_lanczos || args.resize_bicubic) {
+            printf("Redimensionnement %s vers %dx%d...\n", args.resize_lanczos ? "Lanczos-3" : "bicubique",
+                   args.resize_width, args.resize_height);
+            resized = resize_resample(img, args.resize_width, args.resize_height,
+                                      args.resize_lanczos ? RESAMPLE_LANCZOS3 : RESAMPLE_BICUBIC);
+        } else if (args.resize_area) {
+            printf("Redimensionnement par moyenne de surface vers %dx%d...\n", args.resize_width, args.resize_height);
+            resized = resize_area(img, args.resize_width, args.resize_height);
+        } else if (args.resize_bilinear) {
             printf("Redimensionnement bilinéaire vers %dx%d...\n", args.resize_width, args.resize_height);
             resized = resize_bilinear(img, args.resize_width, args.resize_height);
         } else {
@@ -139,13 +161,53 @@ int main(int argc, char *argv[]) {
     // Rotation
     if (args.rotation_angle != 0.0) {
         printf("Rotation de %.2f degrés...\n", args.rotation_angle);
-        Image *rotated = rotate_image(img, args.rotation_angle);
+        Image *rotated = args.rotate_shear
+            ? rotate_image_shear(img, args.rotation_angle, args.rotate_expand)
+            : rotate_image_ex(img, args.rotation_angle,
+                              args.rotate_bilinear ? ROTATE_BILINEAR : ROTATE_NEAREST,
+                              args.rotate_expand);
         if (rotated) {
             freeImage(img);
             img = rotated;
         }
     }
 
+    // Déformation affine ou perspective (même taille que l'image courante)
+    if (args.warp_matrix_size > 0) {
+        printf("Déformation %s...\n", args.warp_matrix_size == 6 ? "affine" : "perspective");
+        Image *warped = args.warp_matrix_size == 6
+            ? warp_affine(img, args.warp_matrix, img->width, img->height, WARP_BILINEAR)
+            : warp_perspective(img, args.warp_matrix, img->width, img->height, WARP_BILINEAR);
+        if (warped) {
+            freeImage(img);
+            img = warped;
+        }
+    }
+
+    // Pyramides (sauvegardées à part, l'image courante n'est pas modifiée)
+    if (args.pyramid_levels > 0) {
+        printf("Construction des pyramides gaussienne et laplacienne (%d niveaux)...\n", args.pyramid_levels);
+        const char *ext = img->channels == 1 ? "pgm" : "ppm";
+        char filename[64];
+        ImagePyramid *gauss = NULL;
+        LaplacianPyramid *lap = NULL;
+        if (build_pyramids(img, args.pyramid_levels, &gauss, &lap) == 0) {
+            for (int i = 0; i < gauss->num_levels; i++) {
+                snprintf(filename, sizeof(filename), "pyramide_gauss_%d.%s", i, ext);
+                savePNM(gauss->levels[i], filename);
+            }
+            for (int i = 0; i < lap->num_levels; i++) {
+                Image *level = laplacian_level_to_image(lap, i);
+                if (!level) continue;
+                snprintf(filename, sizeof(filename), "pyramide_lap_%d.%s", i, ext);
+                savePNM(level, filename);
+                freeImage(level);
+            }
+            free_pyramid(gauss);
+            free_laplacian_pyramid(lap);
+        }
+    }
+
     // ============================================================
     // ÉTAPE 7: ÉGALISATION D'HISTOGRAMME
     // ============================================================
@@ -191,6 +253,32 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    // Flou Gaussien récursif (coût indépendant de sigma)
+    if (args.gaussian_sigma > 0) {
+        printf("Application d'un flou Gaussien récursif (sigma=%.2f)...\n", args.gaussian_sigma);
+        Image *blurred_img = apply_gaussian_blur_sigma(img, args.gaussian_sigma);
+        if (blurred_img) {
+            freeImage(img);
+            img = blurred_img;
+        }
+    }
+
+    // Noyau personnalisé : la méthode (spatiale, séparable, FFT) dépend du coût
+    if (args.kernel_path) {
+        Kernel *kernel = load_kernel(args.kernel_path);
+        if (kernel) {
+            ConvolutionEngine engine = convolution_select_engine(img, kernel);
+            printf("Application du noyau %dx%d de '%s' (convolution %s)...\n",
+                   kernel->width, kernel->height, args.kernel_path, convolution_engine_name(engine));
+            Image *convolved = apply_convolution_ex(img, kernel, engine);
+            if (convolved) {
+                freeImage(img);
+                img = convolved;
+            }
+            free_kernel(kernel);
+        }
+    }
+
     // Netteté
     if (args.apply_sharpen) {
         printf("Application du filtre de netteté...\n");
@@ -235,6 +323,13 @@ int main(int argc, char *argv[]) {
     // ÉTAPE 9: DÉTECTION DE CONTOURS
     // ============================================================
     
+    // Gradient signé (Gx, Gy) gardé pour le vote de Hough contraint par l'orientation :
+    // il est calculé sur l'image en niveaux de gris, avant la détection de contours.
+    GradientField *hough_gradient = NULL;
+    if (args.hough_gradient_tolerance > 0 && args.hough_threshold > 0 && args.apply_sobel) {
+        hough_gradient = compute_sobel_gradient(img);
+    }
+
     // Sobel
     if (args.apply_sobel) {
         printf("Application du filtre de Sobel...\n");
@@ -287,19 +382,81 @@ int main(int argc, char *argv[]) {
                      args.fft_emphasis_radius > 0 ||
                      args.auto_notch_radius > 0);
 
-    if (needs_fft) {
+    // Filtrage par blocs : seulement si aucune option n'a besoin du spectre global
+    int use_tiled_fft = 0;
+    if (needs_fft && args.fft_tile_size > 0) {
+        if (args.test_fft || args.fft_spectrum_path || args.auto_notch_radius > 0) {
+            fprintf(stderr, "Avertissement: --fft-tile ignoré (--test-fft, --fft-spectrum et --auto-notch "
+                            "nécessitent le spectre de l'image entière).\n");
+        } else {
+            use_tiled_fft = 1;
+        }
+    }
+
+    // Un filtrage demandé qui échoue interrompt le programme : sauvegarder
+    // l'image non filtrée ferait passer l'échec pour un succès.
+    int fft_failed = 0;
+    if (use_tiled_fft) {
+        int tile = args.fft_tile_size;
+        printf("Début du filtrage fréquentiel par blocs (%dx%d, marge=%d)...\n", tile, tile, tile / 8);
+        FFTTilePlan *plan = fft_tile_plan_create(tile, tile / 8);
+        if (plan) {
+            // Les rayons restent exprimés dans le spectre de l'image entière
+            freq_filter_set_reference(plan->filter, fft_padded_size(img->width), fft_padded_size(img->height));
+            if (args.fft_lowpass_radius > 0) {
+                printf("Ajout du filtre passe-bas fréquentiel (rayon=%d)...\n", args.fft_lowpass_radius);
+                freq_filter_add_lowpass(plan->filter, args.fft_lowpass_radius);
+            }
+            if (args.fft_highpass_radius > 0) {
+                printf("Ajout du filtre passe-haut fréquentiel (rayon=%d)...\n", args.fft_highpass_radius);
+                freq_filter_add_highpass(plan->filter, args.fft_highpass_radius);
+            }
+            if (args.fft_emphasis_radius > 0) {
+                printf("Ajout du rehaussement spectral (r=%d, L=%.1f, H=%.1f)...\n",
+                       args.fft_emphasis_radius, args.fft_emphasis_low, args.fft_emphasis_high);
+                freq_filter_add_emphasis(plan->filter, args.fft_emphasis_radius,
+                                         args.fft_emphasis_low, args.fft_emphasis_high);
+            }
+            Image *filtered_img = fft_tiled_filter(plan, img);
+            if (filtered_img) {
+                freeImage(img);
+                img = filtered_img;
+            } else {
+                fprintf(stderr, "Erreur: Le filtrage fréquentiel par blocs a échoué.\n");
+                fft_failed = 1;
+            }
+            fft_tile_plan_free(plan);
+        } else {
+            fprintf(stderr, "Erreur: Impossible de créer le plan de filtrage par blocs.\n");
+            fft_failed = 1;
+        }
+    } else if (needs_fft) {
         printf("Début du traitement fréquentiel (FFT)...\n");
         
+        FFTPrecision precision = args.fft_float ? FFT_PRECISION_FLOAT : FFT_PRECISION_DOUBLE;
         int fft_w, fft_h;
-        Complex **fft_result = fft2d(img, &fft_w, &fft_h);
+        // En simple précision, le spectre reste en float (SoA) de bout en bout,
+        // sauf si une option a besoin de la matrice de Complex
+        SplitComplexPlane *fft_plane = NULL;
+        Complex **fft_result = NULL;
+        if (precision == FFT_PRECISION_FLOAT && !args.test_fft && !args.fft_spectrum_path &&
+            args.auto_notch_radius <= 0) {
+            fft_plane = fft2d_f32_image(img);
+            if (fft_plane) {
+                fft_w = fft_plane->width;
+                fft_h = fft_plane->height;
+            }
+        } else {
+            fft_result = fft2d_ex(img, &fft_w, &fft_h, precision);
+        }
         
-        if (fft_result) {
+        if (fft_result || fft_plane) {
             printf("FFT calculée avec succès (dimensions : %dx%d).\n", fft_w, fft_h);
             
             // Test FFT (vérification inverse)
             if (args.test_fft) {
                 printf("Test de la FFT inverse...\n");
-                Image *inversed_img = ifft2d(fft_result, fft_w, fft_h);
+                Image *inversed_img = ifft2d_ex(fft_result, fft_w, fft_h, precision);
                 if (inversed_img) {
                     printf("FFT Inverse calculée avec succès.\n");
                     savePNM(inversed_img, "test_ifft.pgm");
@@ -319,51 +476,84 @@ int main(int argc, char *argv[]) {
                 }
             }
             
+            // Les filtres demandés sont composés en une seule fonction de
+            // transfert H(u,v), appliquée au spectre en une seule passe.
+            FreqFilter *freq_filter = freq_filter_create(fft_w, fft_h);
+            if (!freq_filter) {
+                fprintf(stderr, "Erreur: Impossible de créer le filtre fréquentiel.\n");
+                fft_failed = 1;
+            }
+
             // Filtre passe-bas
-            if (args.fft_lowpass_radius > 0) {
-                printf("Application du filtre passe-bas fréquentiel (rayon=%d)...\n", args.fft_lowpass_radius);
-                fft_lowpass_filter(fft_result, fft_w, fft_h, args.fft_lowpass_radius);
+            if (freq_filter && args.fft_lowpass_radius > 0) {
+                printf("Ajout du filtre passe-bas fréquentiel (rayon=%d)...\n", args.fft_lowpass_radius);
+                freq_filter_add_lowpass(freq_filter, args.fft_lowpass_radius);
             }
             
             // Filtre passe-haut
-            if (args.fft_highpass_radius > 0) {
-                printf("Application du filtre passe-haut fréquentiel (rayon=%d)...\n", args.fft_highpass_radius);
-                fft_highpass_filter(fft_result, fft_w, fft_h, args.fft_highpass_radius);
+            if (freq_filter && args.fft_highpass_radius > 0) {
+                printf("Ajout du filtre passe-haut fréquentiel (rayon=%d)...\n", args.fft_highpass_radius);
+                freq_filter_add_highpass(freq_filter, args.fft_highpass_radius);
             }
             
             // Rehaussement spectral
-            if (args.fft_emphasis_radius > 0) {
-                printf("Application du rehaussement spectral (r=%d, L=%.1f, H=%.1f)...\n", 
+            if (freq_filter && args.fft_emphasis_radius > 0) {
+                printf("Ajout du rehaussement spectral (r=%d, L=%.1f, H=%.1f)...\n", 
                        args.fft_emphasis_radius, args.fft_emphasis_low, args.fft_emphasis_high);
-                fft_emphasis_filter(fft_result, fft_w, fft_h, 
-                                    args.fft_emphasis_radius, args.fft_emphasis_low, args.fft_emphasis_high);
+                freq_filter_add_emphasis(freq_filter, args.fft_emphasis_radius,
+                                         args.fft_emphasis_low, args.fft_emphasis_high);
             }
             
-            // Suppression automatique du bruit
-            if (args.auto_notch_radius > 0) {
+            // Suppression automatique du bruit (détection sur le spectre déjà filtré)
+            if (freq_filter && args.auto_notch_radius > 0) {
                 printf("Détection et suppression automatique du bruit (rayon=%d)...\n", args.auto_notch_radius);
                 double default_threshold_factor = 10.0;
-                fft_auto_notch_filter(fft_result, fft_w, fft_h, default_threshold_factor, args.auto_notch_radius);
+                freq_filter_add_auto_notches(freq_filter, fft_result, default_threshold_factor, args.auto_notch_radius);
             }
+
+            if (freq_filter && freq_filter_op_count(freq_filter) > 0) {
+                printf("Application de la fonction de transfert composite (%d opération(s))...\n",
+                       freq_filter_op_count(freq_filter));
+                int applied = fft_plane ? freq_filter_apply_plane(freq_filter, fft_plane)
+                                        : freq_filter_apply(freq_filter, fft_result);
+                if (applied != 0) {
+                    fprintf(stderr, "Erreur: Impossible d'appliquer le filtre fréquentiel.\n");
+                    fft_failed = 1;
+                }
+            }
+            freq_filter_free(freq_filter);
             
             // FFT Inverse pour revenir au domaine spatial
-            if (args.fft_lowpass_radius > 0 || args.fft_highpass_radius > 0 || 
-                args.fft_emphasis_radius > 0 || args.auto_notch_radius > 0) {
+            if (!fft_failed && (args.fft_lowpass_radius > 0 || args.fft_highpass_radius > 0 ||
+                                args.fft_emphasis_radius > 0 || args.auto_notch_radius > 0)) {
                 printf("Application de la FFT inverse...\n");
-                Image *filtered_img = ifft2d(fft_result, fft_w, fft_h);
+                Image *filtered_img = fft_plane ? ifft2d_f32_image(fft_plane)
+                                                : ifft2d_ex(fft_result, fft_w, fft_h, precision);
                 if (filtered_img) {
                     freeImage(img);
                     img = filtered_img;
+                } else {
+                    fprintf(stderr, "Erreur: La FFT inverse a échoué.\n");
+                    fft_failed = 1;
                 }
             }
             
             // Libération de la mémoire FFT
             free_fft_data(fft_result, fft_h);
+            split_plane_free(fft_plane);
         } else {
             fprintf(stderr, "Erreur: Le calcul de la FFT a échoué.\n");
+            fft_failed = 1;
         }
     }
 
+    if (fft_failed) {
+        fprintf(stderr, "Erreur: Traitement fréquentiel interrompu, aucune image sauvegardée.\n");
+        free_gradient_field(hough_gradient);
+        freeImage(img);
+        return 1;
+    }
+
    // ============================================================
     // ÉTAPE 11: TRANSFORMÉE DE HOUGH
     // ============================================================
@@ -374,7 +564,22 @@ int main(int argc, char *argv[]) {
         printf("Application de la Transformée de Hough (Seuil=%d)...\n", args.hough_threshold);
         
         Image *acc_view = NULL;
-        Image *lines_img = hough_transform(img, &acc_view, args.hough_threshold);
+        HoughOptions hough_opts;
+        hough_default_options(&hough_opts);
+        if (args.hough_gradient_tolerance > 0) {
+            // Sans Sobel préalable (ou si l'image a changé de taille), gradient de l'image courante
+            if (hough_gradient && (hough_gradient->width != img->width || hough_gradient->height != img->height)) {
+                free_gradient_field(hough_gradient);
+                hough_gradient = NULL;
+            }
+            if (!hough_gradient) hough_gradient = compute_sobel_gradient(img);
+            if (hough_gradient) {
+                printf("  Vote contraint par l'orientation du gradient (±%.1f degrés).\n", args.hough_gradient_tolerance);
+                hough_opts.gradient = hough_gradient;
+                hough_opts.gradient_tolerance = args.hough_gradient_tolerance;
+            }
+        }
+        Image *lines_img = hough_transform_ex(img, &acc_view, args.hough_threshold, &hough_opts);
         
         if (lines_img) {
             if (acc_view) {
@@ -387,9 +592,70 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    free_gradient_field(hough_gradient);
+
+    // Hough probabiliste : segments avec extrémités
+    if (args.hough_p_threshold > 0) {
+        printf("Application de la Transformée de Hough probabiliste (Seuil=%d, Longueur min=%d, Écart max=%d)...\n",
+               args.hough_p_threshold, args.hough_p_min_length, args.hough_p_max_gap);
+        HoughSegment *segments = NULL;
+        long voters = 0;
+        int seg_count = hough_probabilistic(img, NULL, args.hough_p_threshold, args.hough_p_min_length,
+                                            args.hough_p_max_gap, &segments, &voters);
+        if (seg_count >= 0) {
+            printf("  -> %d segment(s) détecté(s), %ld point(s) ont voté.\n", seg_count, voters);
+            for (int i = 0; i < seg_count; i++) {
+                printf("     (%d, %d) - (%d, %d) : %d votes\n", segments[i].x1, segments[i].y1,
+                       segments[i].x2, segments[i].y2, segments[i].votes);
+            }
+            Image *segments_img = createImage(img->width, img->height, 1);
+            if (segments_img) {
+                // Contours assombris en fond, segments en blanc
+                for (int i = 0; i < img->width * img->height; i++) segments_img->data[i] = img->data[i] / 3;
+                hough_draw_segments(segments_img, segments, seg_count);
+                freeImage(img);
+                img = segments_img;
+            }
+            free(segments);
+        }
+    }
+
+    // Hough circulaire : centres et rayons (sur l'image en niveaux de gris)
+    if (args.hough_circle_min_radius > 0) {
+        printf("Détection de cercles par Hough (Rayons %d à %d)...\n",
+               args.hough_circle_min_radius, args.hough_circle_max_radius);
+        HoughCircleParams circle_params;
+        hough_circle_default_params(&circle_params, args.hough_circle_min_radius, args.hough_circle_max_radius);
+        HoughCircle *circles = NULL;
+        int circle_count = hough_circles(img, &circle_params, &circles);
+        if (circle_count >= 0) {
+            printf("  -> %d cercle(s) détecté(s).\n", circle_count);
+            for (int i = 0; i < circle_count; i++) {
+                printf("     Centre (%d, %d), rayon %d : %d votes\n", circles[i].x, circles[i].y,
+                       circles[i].radius, circles[i].votes);
+            }
+            Image *circles_img = createImage(img->width, img->height, 1);
+            if (circles_img) {
+                // Image assombrie en fond, cercles en blanc
+                for (int i = 0; i < img->width * img->height; i++) circles_img->data[i] = img->data[i] / 3;
+                hough_draw_circles(circles_img, circles, circle_count);
+                freeImage(img);
+                img = circles_img;
+            }
+            free(circles);
+        }
+    }
+
     // ============================================================
     // ÉTAPE 12: SEGMENTATION (Seuillage / Régions)
     // ============================================================
+
+    // Copie avant segmentation : intensités mesurées par l'étiquetage (étape 13 bis)
+    Image *pre_segmentation = NULL;
+    if (args.label_connectivity > 0 && img->channels == 1) {
+        pre_segmentation = createImage(img->width, img->height, 1);
+        if (pre_segmentation) memcpy(pre_segmentation->data, img->data, (size_t)img->width * img->height);
+    }
     
     // A. Croissance de régions
     if (args.region_tolerance >= 0) {
@@ -401,7 +667,40 @@ int main(int argc, char *argv[]) {
             img = region_mask; // L'image de sortie devient le masque binaire
         }
     }
+    // A bis. Croissance de régions à germes multiples (une étiquette par germe)
+    else if (args.region_seeds_path) {
+        RegionSeed *seeds = NULL;
+        int num_seeds = load_region_seeds(args.region_seeds_path, &seeds);
+        if (num_seeds > 0) {
+            printf("Application de la croissance de régions multiple (%d germes | Tol: %d | Référence: %s)...\n",
+                   num_seeds, args.region_seeds_tolerance, args.region_mean ? "moyenne" : "germe");
+            LabelImage *regions = NULL;
+            long labeled = region_growing_multi(img, seeds, num_seeds, args.region_seeds_tolerance,
+                                                args.region_mean ? REGION_PREDICATE_MEAN : REGION_PREDICATE_SEED,
+                                                &regions);
+            if (labeled >= 0) {
+                printf("  -> %ld pixels étiquetés.\n", labeled);
+                Image *regions_img = label_image_to_image(regions);
+                if (regions_img) { freeImage(img); img = regions_img; }
+                label_image_free(regions);
+            }
+            free(seeds);
+        }
+    }
     // B. Seuillage (Automatique Otsu OU Manuel)
+    else if (args.adaptive_method) {
+        printf("Application du seuillage adaptatif (%s, fenêtre %d, k=%.2f)...\n",
+               args.adaptive_method, args.adaptive_window, args.adaptive_k);
+        apply_adaptive_threshold(img, strcmp(args.adaptive_method, "sauvola") == 0 ? ADAPTIVE_SAUVOLA : ADAPTIVE_BRADLEY,
+                                 args.adaptive_window, args.adaptive_k);
+    }
+    else if (args.otsu_levels > 0) {
+        printf("Calcul et application du seuillage d'Otsu multi-niveaux (%d seuils)...\n", args.otsu_levels);
+        int thresholds[MULTI_OTSU_MAX_THRESHOLDS];
+        if (calculate_multi_otsu_thresholds(img, args.otsu_levels, thresholds) == 0) {
+            apply_multi_threshold(img, thresholds, args.otsu_levels);
+        }
+    }
     else if (args.use_otsu) {
         printf("Calcul et application du seuillage automatique (Otsu)...\n");
         int otsu_val = calculate_otsu_threshold(img);
@@ -443,6 +742,61 @@ int main(int argc, char *argv[]) {
         if (res) { freeImage(img); img = res; }
     }
 
+    // ============================================================
+    // ÉTAPE 13 bis: LIGNE DE PARTAGE DES EAUX
+    // ============================================================
+    // L'image courante sert de relief (ex: après --sobel ou --morph-gradient)
+
+    if (args.watershed_seeds_path) {
+        RegionSeed *seeds = NULL;
+        int num_seeds = load_region_seeds(args.watershed_seeds_path, &seeds);
+        LabelImage *basins = num_seeds > 0 ? label_image_create(img->width, img->height) : NULL;
+        if (basins) {
+            printf("Application de la ligne de partage des eaux (%d marqueurs)...\n", num_seeds);
+            for (int i = 0; i < num_seeds; i++) {
+                if (seeds[i].x >= 0 && seeds[i].x < img->width && seeds[i].y >= 0 && seeds[i].y < img->height) {
+                    basins->labels[seeds[i].y * img->width + seeds[i].x] = (uint32_t)i + 1;
+                } else {
+                    fprintf(stderr, "Attention: Marqueur %d (%d,%d) hors limites, ignoré.\n", i + 1, seeds[i].x, seeds[i].y);
+                }
+            }
+            if (watershed(img, basins) == 0) {
+                Image *basins_img = label_image_to_image(basins);
+                if (basins_img) { freeImage(img); img = basins_img; }
+            }
+            label_image_free(basins);
+        }
+        free(seeds);
+    }
+
+    // ============================================================
+    // ÉTAPE 13 ter: ÉTIQUETAGE DES COMPOSANTES CONNEXES
+    // ============================================================
+
+    if (args.label_connectivity > 0) {
+        printf("Étiquetage des composantes connexes (%d-connexité)...\n", args.label_connectivity);
+        const Image *intensity = pre_segmentation && pre_segmentation->width == img->width &&
+                                 pre_segmentation->height == img->height ? pre_segmentation : NULL;
+        LabelImage *labels = NULL;
+        ComponentStats *stats = NULL;
+        int count = label_components(img, intensity, args.label_connectivity, &labels, &stats);
+        if (count >= 0) {
+            printf("  -> %d composante(s).\n", count);
+            int shown = count < 50 ? count : 50;
+            for (int i = 0; i < shown; i++) {
+                printf("     #%u : aire %ld, boîte [%d,%d]-[%d,%d], centre (%.1f, %.1f), intensité moyenne %.1f\n",
+                       stats[i].label, stats[i].area, stats[i].min_x, stats[i].min_y, stats[i].max_x,
+                       stats[i].max_y, stats[i].centroid_x, stats[i].centroid_y, stats[i].mean_intensity);
+            }
+            if (count > shown) printf("     ... (%d autres)\n", count - shown);
+            Image *labels_img = label_image_to_image(labels);
+            if (labels_img) { freeImage(img); img = labels_img; }
+            label_image_free(labels);
+            free(stats);
+        }
+    }
+    freeImage(pre_segmentation);
+
     // ============================================================
     // ÉTAPE 14: SAUVEGARDE FINALE
     // ============================================================